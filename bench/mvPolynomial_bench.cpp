@@ -0,0 +1,286 @@
+#include "mvPolynomial/mvPolynomial.hpp"
+#include "mvPolynomial/polynomial.hpp"
+#include "mvPolynomial/polynomial_product.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+namespace {
+template <int D>
+using MP   = mvPolynomial::DefaultMVPolynomial<int, double, D>;
+using Poly = mvPolynomial::DefaultPolynomial<int, double>;
+
+// The arguments of the benchmarks are the number of terms and the density in percent, which is
+// the ratio of the number of terms to the number of indexes in the box containing them.
+const auto term_counts     = std::vector<std::int64_t>{10, 100, 1000, 10000, 100000, 1000000};
+const auto product_counts  = std::vector<std::int64_t>{10, 100, 1000};
+const auto densities       = std::vector<std::int64_t>{1, 10, 100};
+const auto product_degrees = std::vector<std::int64_t>{1, 10, 100, 1000};
+
+/**
+ * \brief Return the side of the cubic box of indexes which holds n_terms terms at the density.
+ */
+std::int64_t Side(std::int64_t n_terms, std::int64_t density, int dim) {
+  const auto n_cells = static_cast<double>(n_terms) * 100 / static_cast<double>(density);
+  return std::max<std::int64_t>(1, std::llround(std::ceil(std::pow(n_cells, 1.0 / dim))));
+}
+
+/**
+ * \brief Make a polynomial whose terms are at distinct random indexes in the box of Side.
+ */
+template <class P>
+P RandomPolynomial(std::int64_t n_terms, std::int64_t density, std::uint64_t seed) {
+  const int  dim  = P::dim;
+  const auto side = static_cast<std::uint64_t>(Side(n_terms, density, dim));
+
+  auto n_cells = std::uint64_t(1);
+  for (int axis = 0; axis != dim; ++axis) {
+    n_cells *= side;
+  }
+  const auto n = std::min(static_cast<std::uint64_t>(n_terms), n_cells);
+
+  auto engine = std::mt19937_64(seed);
+  auto cell   = std::uniform_int_distribution<std::uint64_t>(0, n_cells - 1);
+  auto coeff  = std::uniform_real_distribution<double>(-1, 1);
+
+  // Draw the missing cells until n distinct cells are drawn.
+  auto cells = std::vector<std::uint64_t>();
+  cells.reserve(n);
+  while (cells.size() != n) {
+    for (auto k = cells.size(); k != n; ++k) {
+      cells.push_back(cell(engine));
+    }
+    std::sort(cells.begin(), cells.end());
+    cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+  }
+
+  auto terms = std::vector<typename P::value_type>();
+  terms.reserve(n);
+  for (auto c : cells) {
+    auto index = typename P::index_type();
+    if constexpr (P::dim == 1) {
+      index = static_cast<int>(c);
+    } else {
+      for (int axis = 0; axis != dim; ++axis) {
+        index[axis] = static_cast<int>(c % side);
+        c /= side;
+      }
+    }
+    terms.emplace_back(index, coeff(engine));
+  }
+  return P(terms.begin(), terms.end());
+}
+
+/**
+ * \brief Return a point near 1 so that high powers neither overflow nor underflow.
+ */
+template <class P>
+typename P::coord_type Point() {
+  if constexpr (P::dim == 1) {
+    return 1 - 1e-9;
+  } else {
+    auto x = typename P::coord_type();
+    for (int axis = 0; axis != P::dim; ++axis) {
+      x[axis] = 1 - 1e-9 * (axis + 1);
+    }
+    return x;
+  }
+}
+
+template <class P>
+void SetCounters(benchmark::State& state, const P& p) {
+  state.counters["dim"]     = P::dim;
+  state.counters["terms"]   = static_cast<double>(p.size());
+  state.counters["density"] = static_cast<double>(state.range(1));
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(p.size()));
+}
+
+template <class P>
+void BM_Of(benchmark::State& state) {
+  const auto p = RandomPolynomial<P>(state.range(0), state.range(1), 1);
+  const auto x = Point<P>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Of(p, x));
+  }
+  SetCounters(state, p);
+}
+
+template <class P>
+void BM_ExactOf(benchmark::State& state) {
+  const auto p = RandomPolynomial<P>(state.range(0), state.range(1), 1);
+  const auto x = Point<P>();
+  auto       f = mvPolynomial::ExactOf<int, double, P::dim, typename P::allocator_type>(p);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(f(x));
+  }
+  SetCounters(state, p);
+}
+
+template <class P>
+void BM_Add(benchmark::State& state) {
+  const auto p = RandomPolynomial<P>(state.range(0), state.range(1), 1);
+  const auto q = RandomPolynomial<P>(state.range(0), state.range(1), 2);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(p + q);
+  }
+  SetCounters(state, p);
+}
+
+template <class P>
+void BM_Subtract(benchmark::State& state) {
+  const auto p = RandomPolynomial<P>(state.range(0), state.range(1), 1);
+  const auto q = RandomPolynomial<P>(state.range(0), state.range(1), 2);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(p - q);
+  }
+  SetCounters(state, p);
+}
+
+template <class P>
+void BM_Multiply(benchmark::State& state) {
+  const auto p = RandomPolynomial<P>(state.range(0), state.range(1), 1);
+  const auto q = RandomPolynomial<P>(state.range(0), state.range(1), 2);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(p * q);
+  }
+  SetCounters(state, p);
+}
+
+template <class P>
+void BM_D(benchmark::State& state) {
+  const auto p = RandomPolynomial<P>(state.range(0), state.range(1), 1);
+  for (auto _ : state) {
+    if constexpr (P::dim == 1) {
+      benchmark::DoNotOptimize(D(p));
+    } else {
+      benchmark::DoNotOptimize(D(p, P::dim - 1));
+    }
+  }
+  SetCounters(state, p);
+}
+
+template <class P>
+void BM_Integrate(benchmark::State& state) {
+  const auto p = RandomPolynomial<P>(state.range(0), state.range(1), 1);
+  for (auto _ : state) {
+    if constexpr (P::dim == 1) {
+      benchmark::DoNotOptimize(Integrate(p));
+    } else {
+      benchmark::DoNotOptimize(Integrate(p, 0));
+    }
+  }
+  SetCounters(state, p);
+}
+
+/**
+ * \brief Make a product of Dim polynomials whose degrees are range(0) and densities are range(1).
+ */
+template <std::size_t Dim>
+mvPolynomial::PolynomialProduct<Poly, Dim> RandomProduct(benchmark::State& state) {
+  auto polynomials = std::vector<Poly>();
+  for (std::size_t axis = 0; axis != Dim; ++axis) {
+    const auto n_terms = std::max<std::int64_t>(1, (state.range(0) + 1) * state.range(1) / 100);
+    polynomials.push_back(RandomPolynomial<Poly>(n_terms, state.range(1), axis));
+  }
+  return mvPolynomial::PolynomialProduct<Poly, Dim>(polynomials.begin(), polynomials.end());
+}
+
+template <std::size_t Dim>
+typename mvPolynomial::PolynomialProduct<Poly, Dim>::coord_type ProductPoint() {
+  auto x = typename mvPolynomial::PolynomialProduct<Poly, Dim>::coord_type();
+  for (std::size_t axis = 0; axis != Dim; ++axis) {
+    x[axis] = 1 - 1e-9 * (axis + 1);
+  }
+  return x;
+}
+
+void SetProductCounters(benchmark::State& state, std::size_t dim) {
+  state.counters["dim"]     = static_cast<double>(dim);
+  state.counters["degree"]  = static_cast<double>(state.range(0));
+  state.counters["density"] = static_cast<double>(state.range(1));
+}
+
+template <std::size_t Dim>
+void BM_PolynomialProductOf(benchmark::State& state) {
+  const auto p = RandomProduct<Dim>(state);
+  const auto x = ProductPoint<Dim>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Of(p, x));
+  }
+  SetProductCounters(state, Dim);
+}
+
+template <std::size_t Dim>
+void BM_PolynomialProductOfClass(benchmark::State& state) {
+  const auto f = mvPolynomial::PolynomialProductOf<Poly, Dim>(RandomProduct<Dim>(state));
+  const auto x = ProductPoint<Dim>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(f(x));
+  }
+  SetProductCounters(state, Dim);
+}
+
+/**
+ * \brief Calculate a product of Dim polynomials of degree 10 on a grid of range(0) points per axis.
+ */
+template <std::size_t Dim>
+void BM_PolynomialProductOfOnGrid(benchmark::State& state) {
+  auto polynomials = std::vector<Poly>();
+  for (std::size_t axis = 0; axis != Dim; ++axis) {
+    polynomials.push_back(RandomPolynomial<Poly>(11, 100, axis));
+  }
+  const auto p = mvPolynomial::PolynomialProduct<Poly, Dim>(polynomials.begin(), polynomials.end());
+
+  const auto n    = static_cast<std::size_t>(state.range(0));
+  auto       axis = std::vector<double>(n);
+  for (std::size_t i = 0; i != n; ++i) {
+    axis[i] = static_cast<double>(i) / static_cast<double>(n);
+  }
+  auto n_points = std::size_t(1);
+  for (std::size_t k = 0; k != Dim; ++k) {
+    n_points *= n;
+  }
+  auto values = std::vector<double>(n_points);
+  for (auto _ : state) {
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+      mvPolynomial::OfOnGrid(p, values, ((void)I, axis)...);
+    }(std::make_index_sequence<Dim>());
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.counters["dim"] = Dim;
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n_points));
+}
+}  // namespace
+
+#define MVPOLYNOMIAL_BENCHMARK(func, counts)                                             \
+  BENCHMARK_TEMPLATE(func, Poly)->ArgsProduct({counts, densities});                     \
+  BENCHMARK_TEMPLATE(func, MP<2>)->ArgsProduct({counts, densities});                    \
+  BENCHMARK_TEMPLATE(func, MP<3>)->ArgsProduct({counts, densities});                    \
+  BENCHMARK_TEMPLATE(func, MP<4>)->ArgsProduct({counts, densities});                    \
+  BENCHMARK_TEMPLATE(func, MP<8>)->ArgsProduct({counts, densities})
+
+MVPOLYNOMIAL_BENCHMARK(BM_Of, term_counts);
+MVPOLYNOMIAL_BENCHMARK(BM_ExactOf, term_counts);
+MVPOLYNOMIAL_BENCHMARK(BM_Add, term_counts);
+MVPOLYNOMIAL_BENCHMARK(BM_Subtract, term_counts);
+MVPOLYNOMIAL_BENCHMARK(BM_Multiply, product_counts);
+MVPOLYNOMIAL_BENCHMARK(BM_D, term_counts);
+MVPOLYNOMIAL_BENCHMARK(BM_Integrate, term_counts);
+
+BENCHMARK_TEMPLATE(BM_PolynomialProductOf, 2)->ArgsProduct({product_degrees, densities});
+BENCHMARK_TEMPLATE(BM_PolynomialProductOf, 3)->ArgsProduct({product_degrees, densities});
+BENCHMARK_TEMPLATE(BM_PolynomialProductOf, 4)->ArgsProduct({product_degrees, densities});
+BENCHMARK_TEMPLATE(BM_PolynomialProductOf, 8)->ArgsProduct({product_degrees, densities});
+BENCHMARK_TEMPLATE(BM_PolynomialProductOfClass, 2)->ArgsProduct({product_degrees, densities});
+BENCHMARK_TEMPLATE(BM_PolynomialProductOfClass, 8)->ArgsProduct({product_degrees, densities});
+BENCHMARK_TEMPLATE(BM_PolynomialProductOfOnGrid, 2)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK_TEMPLATE(BM_PolynomialProductOfOnGrid, 3)->RangeMultiplier(4)->Range(16, 256);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,142 @@
+#ifndef _MVPOLYNOMIAL_COMPILED_OF_HPP_
+#define _MVPOLYNOMIAL_COMPILED_OF_HPP_
+
+#include "mvPolynomial/type.hpp"
+#include "mvPolynomial/mvPolynomial.hpp"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace mvPolynomial {
+/**
+ * \brief A class calculating f of x by running a flat instruction tape compiled from a polynomial.
+ * \details Each instruction holds a coefficient and the offsets of the powers of each coordinate in
+ * the tables of powers, so the calculation needs no map lookup, no iterator chasing and no
+ * allocation since the tables are sized once by set_polynomial. Unlike Horner's method, the terms
+ * don't depend on each other, so the calculation doesn't stall on the latency of floating point
+ * operations.
+ */
+template <
+    std::signed_integral IntType,
+    class R,
+    int D,
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, D>, R>>>
+class CompiledOf {
+ public:
+  static const int dim{D};
+
+  using polynomial_type = DefaultMVPolynomial<IntType, R, dim, AllocatorOrContainer>;
+  using index_type      = typename polynomial_type::index_type;
+  using coord_type      = typename polynomial_type::coord_type;
+
+  struct Instruction {
+    R coeff;
+    // offsets[i] is the position of x[i] to the power of the index at i in the tables.
+    index_type offsets;
+  };
+
+  using alloc_traits = std::allocator_traits<AllocatorOrContainer>;
+  using tape_type =
+      std::vector<Instruction, typename alloc_traits::template rebind_alloc<Instruction>>;
+  using table_type = std::vector<R, typename alloc_traits::template rebind_alloc<R>>;
+
+  /**
+   * \brief Scratch memory of the const calculation, which each thread owns.
+   * \details It holds the tables of powers of each coordinate.
+   */
+  struct Workspace {
+    table_type table;
+  };
+
+  explicit CompiledOf(const polynomial_type& p) { set_polynomial(p); }
+
+  CompiledOf()                                   = default;
+  CompiledOf(const CompiledOf& other)            = default;
+  CompiledOf& operator=(const CompiledOf& other) = default;
+  CompiledOf(CompiledOf&& other)                 = default;
+  CompiledOf& operator=(CompiledOf&& other)      = default;
+  virtual ~CompiledOf()                          = default;
+
+  auto operator()(const coord_type& x) { return (*this)(x, workspace_); }
+
+  /**
+   * \brief Calculate f of x with the tables of powers in workspace.
+   * \details It doesn't modify this object, so threads can share it if each thread has its own
+   * workspace made by make_workspace().
+   */
+  R operator()(const coord_type& x, Workspace& workspace) const {
+    if (tape_.empty()) {
+      return R(0);
+    }
+    auto& table = workspace.table;
+    auto  it    = table.begin();
+    for (auto axis = 0; axis != dim; ++axis) {
+      *it = 1;
+      for (auto n = 0; n != max_index_[axis]; ++n, ++it) {
+        *std::next(it) = *it * x[axis];
+      }
+      ++it;
+    }
+
+    // Sum up the terms into some sums independently to hide the latency of additions.
+    auto sums = std::array<R, 4>();
+    sums.fill(0);
+    auto i = std::size_t(0);
+    for (; i + sums.size() <= tape_.size(); i += sums.size()) {
+      for (std::size_t j = 0; j != sums.size(); ++j) {
+        sums[j] += Calculate(tape_[i + j], table.data());
+      }
+    }
+    for (; i != tape_.size(); ++i) {
+      sums[0] += Calculate(tape_[i], table.data());
+    }
+    return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+  }
+
+  /**
+   * \brief Make a workspace of the const calculation, which is allocated by the allocator of the
+   * polynomial.
+   */
+  Workspace make_workspace() const {
+    return Workspace{table_type(
+        max_index_.sum() + dim, R(0), typename table_type::allocator_type(tape_.get_allocator())
+    )};
+  }
+
+  const tape_type& get_tape() const noexcept { return tape_; }
+
+  void set_polynomial(const polynomial_type& p) {
+    max_index_ = p.degrees();
+    // The table of axis i starts after the tables of the previous axes.
+    auto table_begins = index_type();
+    table_begins[0]   = 0;
+    for (auto axis = 1; axis != dim; ++axis) {
+      table_begins[axis] = table_begins[axis - 1] + max_index_[axis - 1] + 1;
+    }
+
+    tape_ = tape_type(p.get_allocator());
+    tape_.reserve(p.size());
+    for (const auto& index_and_value : p) {
+      const auto& [index, value] = index_and_value;
+      tape_.push_back(Instruction{value, table_begins + index});
+    }
+    workspace_ = make_workspace();
+  }
+
+ private:
+  static R Calculate(const Instruction& instruction, const R* table) noexcept {
+    auto term = instruction.coeff;
+    for (auto axis = 0; axis != dim; ++axis) {
+      term *= table[instruction.offsets[axis]];
+    }
+    return term;
+  }
+
+  tape_type  tape_;
+  index_type max_index_{index_type::Zero()};
+  Workspace  workspace_;
+};
+}  // namespace mvPolynomial
+
+#endif
@@ -0,0 +1,432 @@
+#ifndef _MVPOLYNOMIAL_DENSE_MVPOLYNOMIAL_HPP_
+#define _MVPOLYNOMIAL_DENSE_MVPOLYNOMIAL_HPP_
+
+#include "mvPolynomial/type.hpp"
+#include "mvPolynomial/index_comparer.hpp"
+#include "mvPolynomial/mvPolynomial.hpp"
+#include "mvPolynomial/validation.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Eigen/Core"
+#include "fmt/core.h"
+
+namespace mvPolynomial {
+/**
+ * \brief Below this length, Convolve multiplies sequences by the schoolbook method.
+ */
+inline constexpr std::size_t karatsuba_threshold = 32;
+
+/**
+ * \brief Add the convolution of a and b to out.
+ * \details Sequences longer than karatsuba_threshold are multiplied by Karatsuba's method, and
+ * if they have different lengths, the longer one is split into blocks of the shorter length.
+ * \param[in] a a sequence of length na.
+ * \param[in] b a sequence of length nb.
+ * \param[in,out] out a sequence of length na + nb - 1.
+ * \param[in] allocator an allocator which is rebound to allocate the temporaries of Karatsuba's
+ * method.
+ */
+template <std::floating_point R, class Allocator = std::allocator<R>>
+void Convolve(
+    const R*         a,
+    std::size_t      na,
+    const R*         b,
+    std::size_t      nb,
+    R*               out,
+    const Allocator& allocator = Allocator()
+) {
+  if (na == 0 || nb == 0) {
+    return;
+  }
+  if (na > nb) {
+    std::swap(a, b);
+    std::swap(na, nb);
+  }
+  if (na <= karatsuba_threshold) {
+    for (std::size_t i = 0; i != na; ++i) {
+      for (std::size_t j = 0; j != nb; ++j) {
+        out[i + j] += a[i] * b[j];
+      }
+    }
+    return;
+  }
+  if (na != nb) {
+    for (std::size_t begin = 0; begin < nb; begin += na) {
+      Convolve(a, na, b + begin, std::min(na, nb - begin), out + begin, allocator);
+    }
+    return;
+  }
+
+  // a = a0 + a1 t^m, b = b0 + b1 t^m, and the lengths of a1 and b1 are h >= m.
+  const auto m = na / 2;
+  const auto h = na - m;
+
+  using Buffer =
+      std::vector<R, typename std::allocator_traits<Allocator>::template rebind_alloc<R>>;
+
+  auto z0 = Buffer(2 * m - 1, R(0), allocator);
+  auto z2 = Buffer(2 * h - 1, R(0), allocator);
+  Convolve(a, m, b, m, z0.data(), allocator);
+  Convolve(a + m, h, b + m, h, z2.data(), allocator);
+
+  auto sa = Buffer(a + m, a + na, allocator);
+  auto sb = Buffer(b + m, b + nb, allocator);
+  for (std::size_t i = 0; i != m; ++i) {
+    sa[i] += a[i];
+    sb[i] += b[i];
+  }
+  auto z1 = Buffer(2 * h - 1, R(0), allocator);
+  Convolve(sa.data(), h, sb.data(), h, z1.data(), allocator);
+  for (std::size_t i = 0; i != z0.size(); ++i) {
+    z1[i] -= z0[i];
+  }
+  for (std::size_t i = 0; i != z2.size(); ++i) {
+    z1[i] -= z2[i];
+  }
+
+  for (std::size_t i = 0; i != z0.size(); ++i) {
+    out[i] += z0[i];
+  }
+  for (std::size_t i = 0; i != z1.size(); ++i) {
+    out[i + m] += z1[i];
+  }
+  for (std::size_t i = 0; i != z2.size(); ++i) {
+    out[i + 2 * m] += z2[i];
+  }
+}
+
+/**
+ * \brief A class implementing a multivariable polynomial which stores all coefficients whose
+ * index is less than or equal to the degree of each axis.
+ * \details The coefficients are stored in lexicographic order of indexes, so the last axis is
+ * contiguous. A product maps indexes into one dimension (Kronecker substitution) with the strides
+ * of the product, which never carry between axes, and convolves the sequences.
+ */
+template <
+    std::signed_integral IntType,
+    std::floating_point  R,
+    int                  Dim,
+    class Allocator = std::allocator<R>>
+class DenseMVPolynomial {
+ public:
+  static_assert(Dim > 0, "DenseMVPolynomial: the dimension must be greater than 0.");
+
+  static constexpr int dim = Dim;
+
+  using index_type     = IndexType<IntType, dim>;
+  using coord_type     = CoordType<R, dim>;
+  using allocator_type = Allocator;
+  using container_type = std::vector<R, allocator_type>;
+  using size_type      = std::size_t;
+
+  // The sparse polynomial uses the same allocator as this one.
+  using sparse_type = DefaultMVPolynomial<
+      IntType,
+      R,
+      dim,
+      typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<index_type, R>>>;
+
+  /**
+   * \brief Make a zero polynomial whose degree of each axis is given.
+   */
+  explicit DenseMVPolynomial(const index_type& degrees, const allocator_type& a = allocator_type())
+      : degrees_(degrees), coeffs_(a) {
+    CheckDegrees(degrees);
+    coeffs_.assign(SizeOf(degrees), R(0));
+  }
+
+  template <class Comparer, class AllocatorOrContainer, class Validation>
+  explicit DenseMVPolynomial(
+      const MVPolynomial<IntType, R, dim, Comparer, AllocatorOrContainer, Validation>& p,
+      const allocator_type& a = allocator_type()
+  )
+      : degrees_(p.degrees()), coeffs_(a) {
+    coeffs_.assign(SizeOf(degrees_), R(0));
+    for (const auto& [index, value] : p) {
+      coeffs_[Offset(index)] += value;
+    }
+  }
+
+  DenseMVPolynomial() = default;
+  DenseMVPolynomial(const DenseMVPolynomial& other)            = default;
+  DenseMVPolynomial& operator=(const DenseMVPolynomial& other) = default;
+  DenseMVPolynomial(DenseMVPolynomial&& other)                 = default;
+  DenseMVPolynomial& operator=(DenseMVPolynomial&& other)      = default;
+  virtual ~DenseMVPolynomial()                                 = default;
+
+  static void CheckAxis(std::size_t axis) {
+    if (axis >= dim) {
+      throw std::runtime_error(
+          fmt::format("CheckAxis: Given axis {} must be in [0, {}).", axis, dim)
+      );
+    }
+  }
+
+  allocator_type get_allocator() const noexcept { return coeffs_.get_allocator(); }
+
+  const index_type& degrees() const noexcept { return degrees_; }
+
+  size_type size() const noexcept { return coeffs_.size(); }
+
+  R*       data() noexcept { return coeffs_.data(); }
+  const R* data() const noexcept { return coeffs_.data(); }
+
+  const container_type& coefficients() const noexcept { return coeffs_; }
+
+  /**
+   * \brief The ratio of nonzero coefficients to all stored coefficients.
+   */
+  double density() const noexcept {
+    const auto nonzeros = std::count_if(coeffs_.begin(), coeffs_.end(), [](R c) { return c != 0; });
+    return static_cast<double>(nonzeros) / static_cast<double>(coeffs_.size());
+  }
+
+  R&       operator[](const index_type& index) { return coeffs_[Offset(index)]; }
+  const R& operator[](const index_type& index) const { return coeffs_[Offset(index)]; }
+
+  R& at(const index_type& index) {
+    CheckIndex(index);
+    return coeffs_[Offset(index)];
+  }
+
+  const R& at(const index_type& index) const {
+    CheckIndex(index);
+    return coeffs_[Offset(index)];
+  }
+
+  /**
+   * \brief Convert into a sparse polynomial dropping zero coefficients.
+   */
+  sparse_type ToMVPolynomial() const {
+    const auto allocator = typename sparse_type::allocator_type(get_allocator());
+    auto       seq       = typename sparse_type::sequence_type(allocator);
+    // The greatest index is at the end.
+    auto index = degrees_;
+    for (auto offset = coeffs_.size(); offset-- != 0;) {
+      if (coeffs_[offset] != 0) {
+        seq.emplace_back(index, coeffs_[offset]);
+      }
+      for (auto axis = dim - 1; axis >= 0; --axis) {
+        if (index[axis]-- != 0) {
+          break;
+        }
+        index[axis] = degrees_[axis];
+      }
+    }
+    if (seq.empty()) {
+      return sparse_type(allocator);
+    }
+    auto sparse = sparse_type(typename sparse_type::key_compare(), allocator);
+    sparse.adopt_sequence(ordered_unique_valid_range, std::move(seq));
+    return sparse;
+  }
+
+  DenseMVPolynomial operator+() const { return *this; }
+
+  DenseMVPolynomial operator-() const {
+    auto p = *this;
+    p *= R(-1);
+    return p;
+  }
+
+  DenseMVPolynomial& operator*=(R r) {
+    for (auto& c : coeffs_) {
+      c *= r;
+    }
+    return *this;
+  }
+
+  // TODO consider tolerance.
+  friend bool operator==(const DenseMVPolynomial& l, const DenseMVPolynomial& r) {
+    return (l.degrees_ == r.degrees_).all() && l.coeffs_ == r.coeffs_;
+  }
+
+  // TODO consider tolerance.
+  friend bool operator!=(const DenseMVPolynomial& l, const DenseMVPolynomial& r) {
+    return !(l == r);
+  }
+
+  friend DenseMVPolynomial operator+(const DenseMVPolynomial& l, const DenseMVPolynomial& r) {
+    auto sum = l.Reshaped(l.degrees_.max(r.degrees_));
+    sum.AddTo(r, R(1));
+    return sum;
+  }
+
+  friend DenseMVPolynomial operator-(const DenseMVPolynomial& l, const DenseMVPolynomial& r) {
+    auto sub = l.Reshaped(l.degrees_.max(r.degrees_));
+    sub.AddTo(r, R(-1));
+    return sub;
+  }
+
+  friend DenseMVPolynomial operator*(const DenseMVPolynomial& l, const DenseMVPolynomial& r) {
+    auto mul = DenseMVPolynomial(l.degrees_ + r.degrees_, l.get_allocator());
+    // With the strides of the product, an index of the product is the sum of the offsets of the
+    // indexes of the factors.
+    const auto l_seq = l.Substitute(mul);
+    const auto r_seq = r.Substitute(mul);
+    Convolve(
+        l_seq.data(),
+        l_seq.size(),
+        r_seq.data(),
+        r_seq.size(),
+        mul.coeffs_.data(),
+        l.get_allocator()
+    );
+    return mul;
+  }
+
+  friend DenseMVPolynomial D(const DenseMVPolynomial& p, std::size_t axis) {
+    CheckAxis(axis);
+
+    if (p.degrees_[axis] == 0) {
+      auto degrees  = p.degrees_;
+      degrees[axis] = 0;
+      return DenseMVPolynomial(degrees, p.get_allocator());
+    }
+    auto degrees = p.degrees_;
+    --degrees[axis];
+    auto dp = DenseMVPolynomial(degrees, p.get_allocator());
+
+    // Split the offset into outer, the index of the axis and inner.
+    const auto inner   = static_cast<size_type>(p.Stride(axis));
+    const auto n       = static_cast<size_type>(p.degrees_[axis]) + 1;
+    const auto n_outer = p.coeffs_.size() / (n * inner);
+    for (size_type o = 0; o != n_outer; ++o) {
+      for (size_type k = 1; k != n; ++k) {
+        const auto src = p.coeffs_.data() + (o * n + k) * inner;
+        const auto dst = dp.coeffs_.data() + (o * (n - 1) + k - 1) * inner;
+        for (size_type i = 0; i != inner; ++i) {
+          dst[i] = static_cast<R>(k) * src[i];
+        }
+      }
+    }
+    return dp;
+  }
+
+  /**
+   * \brief Calculate f of x by Horner's method on each axis from the last one.
+   * \details The pass on the last axis reads the coefficients and the others reduce its results in
+   * place, so the work holds one value per row of the last axis.
+   */
+  friend R Of(const DenseMVPolynomial& p, const coord_type& x) {
+    const auto n_last = static_cast<size_type>(p.degrees_[dim - 1]) + 1;
+
+    auto size = p.coeffs_.size();
+    auto work = container_type(size / n_last, p.get_allocator());
+    auto src  = p.coeffs_.data();
+    for (auto axis = dim - 1; axis >= 0; --axis) {
+      const auto n = static_cast<size_type>(p.degrees_[axis]) + 1;
+      size /= n;
+      for (size_type o = 0; o != size; ++o) {
+        const auto coeffs = src + o * n;
+        auto       value  = coeffs[n - 1];
+        for (auto k = n - 1; k-- != 0;) {
+          value = value * x[axis] + coeffs[k];
+        }
+        work[o] = value;
+      }
+      src = work.data();
+    }
+    return work[0];
+  }
+
+ private:
+  static void CheckDegrees(const index_type& degrees) {
+    if ((degrees < 0).any()) {
+      throw std::runtime_error("Each degree of DenseMVPolynomial must be non-negative.");
+    }
+  }
+
+  void CheckIndex(const index_type& index) const {
+    if ((index < 0).any() || (index > degrees_).any()) {
+      throw std::out_of_range("DenseMVPolynomial::at: the index is out of the degrees.");
+    }
+  }
+
+  static size_type SizeOf(const index_type& degrees) {
+    return static_cast<size_type>((degrees.template cast<std::ptrdiff_t>() + 1).prod());
+  }
+
+  std::ptrdiff_t Stride(int axis) const {
+    auto stride = std::ptrdiff_t(1);
+    for (auto i = dim - 1; i > axis; --i) {
+      stride *= degrees_[i] + 1;
+    }
+    return stride;
+  }
+
+  size_type Offset(const index_type& index) const {
+    auto offset = std::ptrdiff_t(0);
+    for (auto axis = 0; axis != dim; ++axis) {
+      offset = offset * (degrees_[axis] + 1) + index[axis];
+    }
+    return static_cast<size_type>(offset);
+  }
+
+  /**
+   * \brief Copy the coefficients into the layout of the degrees, which are not less than degrees_.
+   */
+  DenseMVPolynomial Reshaped(const index_type& degrees) const {
+    auto p = DenseMVPolynomial(degrees, get_allocator());
+    ForEachRow([this, &p](const index_type& index, size_type offset) {
+      const auto n = degrees_[dim - 1] + 1;
+      std::copy_n(coeffs_.data() + offset, n, p.coeffs_.data() + p.Offset(index));
+    });
+    return p;
+  }
+
+  /**
+   * \brief Add sign * r to this polynomial, whose degrees are not less than those of r.
+   */
+  void AddTo(const DenseMVPolynomial& r, R sign) {
+    r.ForEachRow([this, &r, sign](const index_type& index, size_type offset) {
+      const auto dst = coeffs_.data() + Offset(index);
+      for (IntType i = 0; i <= r.degrees_[dim - 1]; ++i) {
+        dst[i] += sign * r.coeffs_[offset + i];
+      }
+    });
+  }
+
+  /**
+   * \brief Lay the coefficients out in one dimension with the strides of the product.
+   */
+  container_type Substitute(const DenseMVPolynomial& product) const {
+    auto seq = container_type(product.Offset(degrees_) + 1, R(0), get_allocator());
+    ForEachRow([this, &product, &seq](const index_type& index, size_type offset) {
+      const auto n = degrees_[dim - 1] + 1;
+      std::copy_n(coeffs_.data() + offset, n, seq.data() + product.Offset(index));
+    });
+    return seq;
+  }
+
+  /**
+   * \brief Call f with the first index and offset of each contiguous row of the last axis.
+   */
+  template <class F>
+  void ForEachRow(F f) const {
+    auto       index = index_type::Zero().eval();
+    const auto n     = static_cast<size_type>(degrees_[dim - 1]) + 1;
+    for (size_type offset = 0; offset < coeffs_.size(); offset += n) {
+      f(index, offset);
+      for (auto axis = dim - 2; axis >= 0; --axis) {
+        if (++index[axis] <= degrees_[axis]) {
+          break;
+        }
+        index[axis] = 0;
+      }
+    }
+  }
+
+  index_type     degrees_{index_type::Zero()};
+  container_type coeffs_{R(0)};
+};
+}  // namespace mvPolynomial
+
+#endif
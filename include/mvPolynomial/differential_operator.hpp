@@ -0,0 +1,215 @@
+#ifndef _MVPOLYNOMIAL_DIFFERENTIAL_OPERATOR_HPP_
+#define _MVPOLYNOMIAL_DIFFERENTIAL_OPERATOR_HPP_
+
+#include "mvPolynomial/validation.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "fmt/core.h"
+
+namespace mvPolynomial {
+/**
+ * \brief A class which differentiates and integrates polynomials which have the same indexes.
+ * \details It calculates the indexes of the derivative and the antiderivative along each axis,
+ * their order and the scale of each coefficient once, so differentiating or integrating a
+ * polynomial with the same indexes (ex. the coefficients updated at each time step) is a linear
+ * gather without any sort.
+ * \tparam Polynomial MVPolynomial or Polynomial.
+ */
+template <class Polynomial>
+class DifferentialOperator {
+ public:
+  using polynomial_type = Polynomial;
+  using index_type      = typename polynomial_type::index_type;
+  using mapped_type     = typename polynomial_type::mapped_type;
+  using sequence_type   = typename polynomial_type::sequence_type;
+  using size_type       = typename polynomial_type::size_type;
+  using allocator_type  = typename polynomial_type::allocator_type;
+
+  static constexpr int dim = polynomial_type::dim;
+
+  /**
+   * \brief Record the indexes of p.
+   */
+  explicit DifferentialOperator(const polynomial_type& p)
+      : support_(p.begin(), p.end(), p.get_allocator()) {
+    for (int axis = 0; axis != dim; ++axis) {
+      derivatives_[axis]     = MakeGather(p, axis, true);
+      antiderivatives_[axis] = MakeGather(p, axis, false);
+    }
+  }
+
+  DifferentialOperator(const DifferentialOperator& other)            = default;
+  DifferentialOperator& operator=(const DifferentialOperator& other) = default;
+  DifferentialOperator(DifferentialOperator&& other)                 = default;
+  DifferentialOperator& operator=(DifferentialOperator&& other)      = default;
+  virtual ~DifferentialOperator()                                    = default;
+
+  size_type size() const noexcept { return support_.size(); }
+
+  /**
+   * \brief Return true if p has the same indexes as the polynomial given to the constructor.
+   */
+  bool has_same_support(const polynomial_type& p) const {
+    return std::equal(
+        support_.begin(),
+        support_.end(),
+        p.begin(),
+        p.end(),
+        [](const typename sequence_type::value_type& l, const auto& r) {
+          return IsEqual(l.first, r.first);
+        }
+    );
+  }
+
+  /**
+   * \brief Differentiate p along the axis.
+   * \param[in] p a polynomial which has the same indexes as the recorded ones.
+   */
+  polynomial_type differentiate(const polynomial_type& p, std::size_t axis = 0) const {
+    auto d = polynomial_type(p.key_comp(), p.get_allocator());
+    differentiate(p, axis, d);
+    return d;
+  }
+
+  /**
+   * \brief Differentiate p along the axis into out, reusing the capacity of out.
+   */
+  void differentiate(const polynomial_type& p, std::size_t axis, polynomial_type& out) const {
+    Apply(derivatives_, p, axis, out);
+  }
+
+  /**
+   * \brief Integrate p along the axis.
+   * \param[in] p a polynomial which has the same indexes as the recorded ones.
+   */
+  polynomial_type integrate(const polynomial_type& p, std::size_t axis = 0) const {
+    auto integral = polynomial_type(p.key_comp(), p.get_allocator());
+    integrate(p, axis, integral);
+    return integral;
+  }
+
+  /**
+   * \brief Integrate p along the axis into out, reusing the capacity of out.
+   */
+  void integrate(const polynomial_type& p, std::size_t axis, polynomial_type& out) const {
+    Apply(antiderivatives_, p, axis, out);
+  }
+
+ private:
+  template <class T>
+  using rebind_alloc = typename std::allocator_traits<allocator_type>::template rebind_alloc<T>;
+
+  // The position of a source term and the scale of its coefficient.
+  using source_type        = std::pair<size_type, mapped_type>;
+  using source_vector_type = std::vector<source_type, rebind_alloc<source_type>>;
+
+  /**
+   * \brief The indexes of the result in order and the source of each term.
+   */
+  struct Gather {
+    sequence_type      indexes;
+    source_vector_type sources;
+  };
+
+  static bool IsEqual(const index_type& l, const index_type& r) {
+    if constexpr (dim == 1) {
+      return l == r;
+    } else {
+      return (l == r).all();
+    }
+  }
+
+  static auto& At(index_type& index, std::size_t axis) {
+    if constexpr (dim == 1) {
+      return index;
+    } else {
+      return index[axis];
+    }
+  }
+
+  static void CheckAxis(std::size_t axis) {
+    if (axis >= static_cast<std::size_t>(dim)) {
+      throw std::runtime_error(
+          fmt::format("DifferentialOperator: Given axis {} must be in [0, {}).", axis, dim)
+      );
+    }
+  }
+
+  static Gather MakeGather(const polynomial_type& p, std::size_t axis, bool is_derivative) {
+    const auto allocator = p.get_allocator();
+
+    using term_type = std::pair<typename sequence_type::value_type, size_type>;
+    auto terms      = std::vector<term_type, rebind_alloc<term_type>>(allocator);
+    terms.reserve(p.size());
+    auto position = size_type(0);
+    for (auto index_and_value : p) {
+      auto& [index, value] = index_and_value;
+      auto& element        = At(index, axis);
+      if (is_derivative) {
+        if (element != 0) {
+          value = element--;
+          terms.emplace_back(index_and_value, position);
+        }
+      } else {
+        value = mapped_type(1) / ++element;
+        terms.emplace_back(index_and_value, position);
+      }
+      ++position;
+    }
+    // Sort the terms once, so that applying the gather keeps the order by the comparer.
+    const auto comparer = p.key_comp();
+    std::sort(terms.begin(), terms.end(), [&comparer](const auto& l, const auto& r) {
+      return comparer(l.first.first, r.first.first);
+    });
+
+    auto gather = Gather{sequence_type(allocator), source_vector_type(allocator)};
+    gather.indexes.reserve(terms.size());
+    gather.sources.reserve(terms.size());
+    for (const auto& [index_and_scale, source] : terms) {
+      gather.indexes.emplace_back(index_and_scale.first, 0);
+      gather.sources.emplace_back(source, index_and_scale.second);
+    }
+    return gather;
+  }
+
+  void Apply(
+      const std::array<Gather, dim>& gathers,
+      const polynomial_type&         p,
+      std::size_t                    axis,
+      polynomial_type&               out
+  ) const {
+    CheckAxis(axis);
+    if (p.size() != support_.size()) {
+      throw std::runtime_error(fmt::format(
+          "DifferentialOperator: The polynomial has {} terms, but {} terms are recorded.",
+          p.size(),
+          support_.size()
+      ));
+    }
+    const auto& gather = gathers[axis];
+    const auto  terms  = p.begin();
+
+    // If out is p, its terms are read while the result is written, so gather into a new sequence.
+    auto seq = &out == &p ? sequence_type(p.get_allocator()) : out.extract_sequence();
+    seq.assign(gather.indexes.begin(), gather.indexes.end());
+    for (size_type k = 0; k != seq.size(); ++k) {
+      const auto& [source, scale] = gather.sources[k];
+      seq[k].second               = scale * terms[source].second;
+    }
+    out.adopt_sequence(ordered_unique_valid_range, std::move(seq));
+  }
+
+  sequence_type           support_;
+  std::array<Gather, dim> derivatives_;
+  std::array<Gather, dim> antiderivatives_;
+};
+}  // namespace mvPolynomial
+
+#endif
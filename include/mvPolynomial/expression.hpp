@@ -0,0 +1,328 @@
+#ifndef _MVPOLYNOMIAL_EXPRESSION_HPP_
+#define _MVPOLYNOMIAL_EXPRESSION_HPP_
+
+#include "mvPolynomial/sum.hpp"
+#include "mvPolynomial/validation.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace mvPolynomial {
+/**
+ * \brief A concept of nodes of lazy polynomial expressions made by Lazy.
+ */
+template <class E>
+concept PolynomialExpression = requires { typename E::polynomial_type; } && E::is_expression;
+
+template <class P>
+class PolynomialRef;
+
+template <class L, class R>
+class SumExpression;
+
+template <class L, class R>
+class ProductExpression;
+
+template <class E>
+class ScaledExpression;
+
+/**
+ * \brief A term of a flattened expression, a coefficient times a product of polynomials.
+ */
+template <class P>
+struct ExpressionTerm {
+  typename P::mapped_type  coeff;
+  detail::PointerVector<P> factors;
+};
+
+// The terms are allocated by a default allocator of the polynomial type.
+template <class P>
+using ExpressionTerms = std::vector<
+    ExpressionTerm<P>,
+    typename std::allocator_traits<typename P::allocator_type>::template rebind_alloc<
+        ExpressionTerm<P>>>;
+
+// The polynomials made while evaluating an expression, which the terms point to.
+template <class P>
+using ExpressionTemporaries = std::deque<
+    P,
+    typename std::allocator_traits<typename P::allocator_type>::template rebind_alloc<P>>;
+
+namespace detail {
+/**
+ * \brief Calculate a sum of scaled products of polynomials.
+ * \details Each product is multiplied by operator* of the polynomial into temporaries, and then
+ * all of the products and the single polynomials are merged by one heap with their coefficients.
+ */
+template <class P>
+P EvaluateTerms(const ExpressionTerms<P>& terms, ExpressionTemporaries<P>& temporaries) {
+  auto polynomials = PointerVector<P>(terms.front().factors.front()->get_allocator());
+  polynomials.reserve(terms.size());
+  for (const auto& term : terms) {
+    if (term.factors.size() == 1) {
+      polynomials.push_back(term.factors.front());
+      continue;
+    }
+    temporaries.push_back(*term.factors[0] * *term.factors[1]);
+    for (std::size_t i = 2; i != term.factors.size(); ++i) {
+      temporaries.back() *= *term.factors[i];
+    }
+    polynomials.push_back(&temporaries.back());
+  }
+
+  const auto& first = *polynomials.front();
+  auto        seq   = typename P::sequence_type(first.get_allocator());
+  MergeSum(polynomials, [&terms](std::size_t k) { return terms[k].coeff; }, first.key_comp(), seq);
+  auto result = P(first.key_comp(), first.get_allocator());
+  result.adopt_sequence(ordered_unique_valid_range, std::move(seq));
+  return result;
+}
+}  // namespace detail
+
+/**
+ * \brief A base class of nodes of lazy polynomial expressions.
+ * \details A node holds its children by value and the leaves hold references to polynomials, so
+ * the polynomials must live until the expression is evaluated. The expression is evaluated when it
+ * is converted into the polynomial type.
+ */
+template <class P, class Derived>
+class Expression {
+ public:
+  static constexpr bool is_expression = true;
+
+  using polynomial_type = P;
+  using mapped_type     = typename P::mapped_type;
+  using coord_type      = typename P::coord_type;
+
+  operator polynomial_type() const { return Evaluate(static_cast<const Derived&>(*this)); }
+};
+
+template <class P>
+class PolynomialRef : public Expression<P, PolynomialRef<P>> {
+ public:
+  explicit PolynomialRef(const P& p) : p_(&p) {}
+
+  const P& get() const noexcept { return *p_; }
+
+  const P& first() const noexcept { return *p_; }
+
+  void Flatten(ExpressionTerms<P>& terms, ExpressionTemporaries<P>&) const {
+    terms.push_back({1, {p_}});
+  }
+
+  friend auto Of(const PolynomialRef& e, const typename P::coord_type& x) { return Of(*e.p_, x); }
+
+ private:
+  const P* p_;
+};
+
+template <class L, class R>
+class SumExpression : public Expression<typename L::polynomial_type, SumExpression<L, R>> {
+ public:
+  using mapped_type = typename L::mapped_type;
+
+  using polynomial_type = typename L::polynomial_type;
+
+  SumExpression(const L& l, const R& r, mapped_type sign) : l_(l), r_(r), sign_(sign) {}
+
+  const polynomial_type& first() const noexcept { return l_.first(); }
+
+  void Flatten(
+      ExpressionTerms<polynomial_type>& terms, ExpressionTemporaries<polynomial_type>& temporaries
+  ) const {
+    l_.Flatten(terms, temporaries);
+    const auto r_begin = terms.size();
+    r_.Flatten(terms, temporaries);
+    for (auto k = r_begin; k != terms.size(); ++k) {
+      terms[k].coeff *= sign_;
+    }
+  }
+
+  friend auto Of(const SumExpression& e, const typename L::coord_type& x) {
+    return Of(e.l_, x) + e.sign_ * Of(e.r_, x);
+  }
+
+ private:
+  L           l_;
+  R           r_;
+  mapped_type sign_;
+};
+
+template <class L, class R>
+class ProductExpression
+    : public Expression<typename L::polynomial_type, ProductExpression<L, R>> {
+ public:
+  using polynomial_type = typename L::polynomial_type;
+
+  ProductExpression(const L& l, const R& r) : l_(l), r_(r) {}
+
+  const polynomial_type& first() const noexcept { return l_.first(); }
+
+  /**
+   * \brief Append the product as one term whose factors are those of both operands.
+   * \details An operand which is a sum is evaluated into a temporary by one merge instead of
+   * distributing the product over it, so (a + b) * (c + d) costs two merges and one
+   * multiplication instead of four multiplications.
+   */
+  void Flatten(
+      ExpressionTerms<polynomial_type>& terms, ExpressionTemporaries<polynomial_type>& temporaries
+  ) const {
+    auto term = Factor(l_, temporaries);
+    auto r    = Factor(r_, temporaries);
+    term.coeff *= r.coeff;
+    term.factors.insert(term.factors.end(), r.factors.begin(), r.factors.end());
+    terms.push_back(std::move(term));
+  }
+
+  friend auto Of(const ProductExpression& e, const typename L::coord_type& x) {
+    return Of(e.l_, x) * Of(e.r_, x);
+  }
+
+ private:
+  /**
+   * \brief Flatten an operand into one term, evaluating it into a temporary if it is a sum.
+   */
+  template <class E>
+  static ExpressionTerm<polynomial_type> Factor(
+      const E& e, ExpressionTemporaries<polynomial_type>& temporaries
+  ) {
+    auto terms = ExpressionTerms<polynomial_type>();
+    e.Flatten(terms, temporaries);
+    if (terms.size() == 1) {
+      return std::move(terms.front());
+    }
+    temporaries.push_back(detail::EvaluateTerms(terms, temporaries));
+    auto factors = detail::PointerVector<polynomial_type>(e.first().get_allocator());
+    factors.push_back(&temporaries.back());
+    return {1, std::move(factors)};
+  }
+
+  L l_;
+  R r_;
+};
+
+template <class E>
+class ScaledExpression : public Expression<typename E::polynomial_type, ScaledExpression<E>> {
+ public:
+  using polynomial_type = typename E::polynomial_type;
+  using mapped_type     = typename E::mapped_type;
+
+  ScaledExpression(const E& e, mapped_type c) : e_(e), c_(c) {}
+
+  const polynomial_type& first() const noexcept { return e_.first(); }
+
+  void Flatten(
+      ExpressionTerms<polynomial_type>& terms, ExpressionTemporaries<polynomial_type>& temporaries
+  ) const {
+    const auto begin = terms.size();
+    e_.Flatten(terms, temporaries);
+    for (auto k = begin; k != terms.size(); ++k) {
+      terms[k].coeff *= c_;
+    }
+  }
+
+  friend auto Of(const ScaledExpression& e, const typename E::coord_type& x) {
+    return e.c_ * Of(e.e_, x);
+  }
+
+ private:
+  E           e_;
+  mapped_type c_;
+};
+
+/**
+ * \brief Start a lazy expression from a polynomial (ex. MVPolynomial, Polynomial).
+ * \details The operators of the expression record the tree, and the conversion into the
+ * polynomial type or Evaluate calculates it once.
+ */
+template <class P>
+PolynomialRef<P> Lazy(const P& p) {
+  return PolynomialRef<P>(p);
+}
+
+template <class T>
+struct ExpressionPolynomial {
+  using type = T;
+};
+
+template <PolynomialExpression E>
+struct ExpressionPolynomial<E> {
+  using type = typename E::polynomial_type;
+};
+
+/**
+ * \brief A concept of operands of lazy expressions, one of which must be an expression.
+ */
+template <class L, class R>
+concept ExpressionOperands =
+    (PolynomialExpression<L> || PolynomialExpression<R>)
+    && std::same_as<typename ExpressionPolynomial<L>::type, typename ExpressionPolynomial<R>::type>;
+
+template <class T>
+auto AsExpression(const T& t) {
+  if constexpr (PolynomialExpression<T>) {
+    return t;
+  } else {
+    return Lazy(t);
+  }
+}
+
+template <class L, class R>
+  requires ExpressionOperands<L, R>
+auto operator+(const L& l, const R& r) {
+  using Expr = SumExpression<decltype(AsExpression(l)), decltype(AsExpression(r))>;
+  return Expr(AsExpression(l), AsExpression(r), 1);
+}
+
+template <class L, class R>
+  requires ExpressionOperands<L, R>
+auto operator-(const L& l, const R& r) {
+  using Expr = SumExpression<decltype(AsExpression(l)), decltype(AsExpression(r))>;
+  return Expr(AsExpression(l), AsExpression(r), -1);
+}
+
+template <class L, class R>
+  requires ExpressionOperands<L, R>
+auto operator*(const L& l, const R& r) {
+  using Expr = ProductExpression<decltype(AsExpression(l)), decltype(AsExpression(r))>;
+  return Expr(AsExpression(l), AsExpression(r));
+}
+
+template <PolynomialExpression E>
+auto operator*(typename E::mapped_type c, const E& e) {
+  return ScaledExpression<E>(e, c);
+}
+
+template <PolynomialExpression E>
+auto operator*(const E& e, typename E::mapped_type c) {
+  return ScaledExpression<E>(e, c);
+}
+
+template <PolynomialExpression E>
+auto operator-(const E& e) {
+  return ScaledExpression<E>(e, -1);
+}
+
+/**
+ * \brief Evaluate a lazy expression at once.
+ * \details The top-level linear combination is flattened into a sum of scaled products of
+ * polynomials, and the sums inside products are evaluated into temporaries first. Each product
+ * is multiplied by operator* of the polynomial, and then all of the products and the single
+ * polynomials are merged by one heap with their coefficients, so no scaled copy is made.
+ */
+template <PolynomialExpression E>
+typename E::polynomial_type Evaluate(const E& e) {
+  using P = typename E::polynomial_type;
+
+  auto terms       = ExpressionTerms<P>();
+  auto temporaries = ExpressionTemporaries<P>(e.first().get_allocator());
+  e.Flatten(terms, temporaries);
+  return detail::EvaluateTerms(terms, temporaries);
+}
+}  // namespace mvPolynomial
+
+#endif
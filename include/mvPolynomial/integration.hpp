@@ -0,0 +1,276 @@
+#ifndef _MVPOLYNOMIAL_INTEGRATION_HPP_
+#define _MVPOLYNOMIAL_INTEGRATION_HPP_
+
+#include "mvPolynomial/type.hpp"
+#include "mvPolynomial/mvPolynomial.hpp"
+#include "mvPolynomial/polynomial_product.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "Eigen/Core"
+#include "Eigen/LU"
+#include "fmt/core.h"
+
+namespace mvPolynomial {
+namespace detail {
+/**
+ * \brief Tabulate the complete homogeneous symmetric polynomials h_0, ..., h_degree of points.
+ * \details h_n is the sum of all monomials of degree n in the points, and adding a point x updates
+ * it by h_n += x h_{n-1} in ascending order of n. The integral of x^n over [lo, hi] is
+ * (hi - lo) h_n(lo, hi) / (n + 1), which doesn't cancel when lo is close to hi.
+ * \param[out] h an iterator to degree + 1 elements.
+ */
+template <class Derived, class Iterator>
+void CompleteHomogeneous(const Eigen::DenseBase<Derived>& points, std::size_t degree, Iterator h) {
+  using Scalar = typename Derived::Scalar;
+
+  std::fill(h, h + degree + 1, Scalar(0));
+  h[0] = Scalar(1);
+  for (Eigen::Index i = 0; i != points.size(); ++i) {
+    for (std::size_t n = 1; n <= degree; ++n) {
+      h[n] += points(i) * h[n - 1];
+    }
+  }
+}
+
+/**
+ * \brief Calculate the integral of f over the standard simplex mapped onto vertices, divided by
+ * D! times its volume, by the Grundmann-Moller rule.
+ * \details The rule of s = degree / 2 is exact for polynomials of total degree up to 2 s + 1. Its
+ * points are the barycentric coordinates (2 b_j + 1) / (d + D - 2 i) for each i <= s and each b
+ * of |b| = s - i, whose weight is (-1)^i 2^{-2 s} (d + D - 2 i)^d / (i! (d + D - i)!) with
+ * d = 2 s + 1.
+ * \param[in] vertices a D x (D + 1) array whose columns are the vertices.
+ */
+template <std::floating_point R, int D, class Function>
+R GrundmannMoller(const CoordArrayType<R, D>& vertices, std::size_t degree, Function&& f) {
+  const auto s = degree / 2;
+  const auto d = 2 * s + 1;
+
+  auto sum         = R(0);
+  auto barycentric = std::array<std::size_t, D + 1>();
+  auto x           = CoordType<R, D>();
+  for (std::size_t i = 0; i <= s; ++i) {
+    const auto denominator = static_cast<R>(d + D - 2 * i);
+
+    // Multiply and divide alternately, so the weight doesn't overflow.
+    auto weight = std::ldexp(R(1), -2 * static_cast<int>(s));
+    for (std::size_t k = 1; k <= d + D - i; ++k) {
+      weight /= static_cast<R>(k);
+      if (k <= d) {
+        weight *= denominator;
+      }
+    }
+    for (std::size_t k = 2; k <= i; ++k) {
+      weight /= static_cast<R>(k);
+    }
+
+    // Visit each b of |b| = s - i by moving one unit from the first nonzero element to the next.
+    auto points_sum = R(0);
+    barycentric.fill(0);
+    barycentric[0] = s - i;
+    while (true) {
+      x.setZero();
+      for (int j = 0; j != D + 1; ++j) {
+        x += static_cast<R>(2 * barycentric[j] + 1) / denominator * vertices.col(j);
+      }
+      points_sum += f(x);
+
+      const auto first = std::find_if(barycentric.begin(), barycentric.end() - 1, [](auto b) {
+        return b != 0;
+      });
+      if (first == barycentric.end() - 1) {
+        break;
+      }
+      const auto b   = *first;
+      *first         = 0;
+      barycentric[0] = b - 1;
+      ++*(first + 1);
+    }
+    sum += (i % 2 == 0 ? weight : -weight) * points_sum;
+  }
+  return sum;
+}
+
+/**
+ * \brief Return D! times the volume of a simplex, which is the absolute value of the determinant
+ * of its edges from the first vertex.
+ * \param[in] vertices a D x (D + 1) array whose columns are the vertices.
+ */
+template <std::floating_point R, int D>
+R SimplexJacobian(const CoordArrayType<R, D>& vertices) {
+  if (vertices.cols() != D + 1) {
+    throw std::runtime_error(fmt::format(
+        "IntegrateSimplex: Given {} vertices, but a simplex of dimension {} has {} vertices.",
+        vertices.cols(),
+        D,
+        D + 1
+    ));
+  }
+  auto edges = Eigen::Matrix<R, D, D>();
+  for (int i = 0; i != D; ++i) {
+    edges.col(i) = (vertices.col(i + 1) - vertices.col(0)).matrix();
+  }
+  return std::abs(edges.determinant());
+}
+
+/**
+ * \brief Return the greatest index of the terms of a univariate polynomial.
+ */
+template <class P>
+std::size_t MaxIndex(const P& p) {
+  auto degree = typename P::index_type(0);
+  for (const auto& index_and_value : p) {
+    degree = std::max(degree, index_and_value.first);
+  }
+  return static_cast<std::size_t>(degree);
+}
+}  // namespace detail
+
+/**
+ * \brief Calculate the integral of p over the box [lo, hi].
+ * \details The integrals of x_k^0, ..., x_k^{degrees_k} of each axis are tabulated once, so the
+ * integral is one pass over the terms without making any antiderivative.
+ */
+template <
+    std::signed_integral IntType,
+    std::floating_point  R,
+    int                  D,
+    class Comparer,
+    class AllocatorOrContainer,
+    class Validation>
+R IntegrateBox(
+    const MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>& p,
+    const CoordType<R, D>&                                                         lo,
+    const CoordType<R, D>&                                                         hi
+) {
+  using MP    = MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>;
+  using Alloc = typename std::allocator_traits<
+      typename MP::allocator_type>::template rebind_alloc<R>;
+
+  const auto& degrees   = p.degrees();
+  auto        offsets   = std::array<std::size_t, D>();
+  auto        n_moments = std::size_t(0);
+  for (int axis = 0; axis != D; ++axis) {
+    offsets[axis] = n_moments;
+    n_moments += static_cast<std::size_t>(degrees[axis]) + 1;
+  }
+  auto moments = std::vector<R, Alloc>(n_moments, p.get_allocator());
+  for (int axis = 0; axis != D; ++axis) {
+    const auto degree = static_cast<std::size_t>(degrees[axis]);
+    const auto bounds = Eigen::Array<R, 2, 1>(lo[axis], hi[axis]);
+    const auto h      = moments.begin() + offsets[axis];
+    detail::CompleteHomogeneous(bounds, degree, h);
+    for (std::size_t n = 0; n <= degree; ++n) {
+      h[n] *= (hi[axis] - lo[axis]) / static_cast<R>(n + 1);
+    }
+  }
+
+  auto sum = R(0);
+  for (const auto& index_and_value : p) {
+    const auto& [index, value] = index_and_value;
+    auto moment                = value;
+    for (int axis = 0; axis != D; ++axis) {
+      moment *= moments[offsets[axis] + index[axis]];
+    }
+    sum += moment;
+  }
+  return sum;
+}
+
+/**
+ * \brief Calculate the integral of p over a simplex.
+ * \details The moments of a general simplex couple the axes, so p is calculated at the points of
+ * the Grundmann-Moller rule which is exact for its total degree; the number of points depends
+ * only on the total degree and D.
+ * \param[in] vertices a D x (D + 1) array whose columns are the vertices.
+ */
+template <
+    std::signed_integral IntType,
+    std::floating_point  R,
+    int                  D,
+    class Comparer,
+    class AllocatorOrContainer,
+    class Validation>
+R IntegrateSimplex(
+    const MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>& p,
+    const CoordArrayType<R, D>&                                                    vertices
+) {
+  const auto jacobian = detail::SimplexJacobian(vertices);
+
+  auto degree = IntType(0);
+  for (const auto& index_and_value : p) {
+    degree = std::max(degree, index_and_value.first.sum());
+  }
+  const auto sum = detail::GrundmannMoller(
+      vertices, static_cast<std::size_t>(degree), [&p](const CoordType<R, D>& x) {
+        return Of(p, x);
+      }
+  );
+  return jacobian * sum;
+}
+
+/**
+ * \brief Calculate the integral of pp over the box [lo, hi], which is the product of the
+ * integrals of its polynomials.
+ */
+template <class P, std::size_t Dim>
+auto IntegrateBox(
+    const PolynomialProduct<P, Dim>&                      pp,
+    const typename PolynomialProduct<P, Dim>::coord_type& lo,
+    const typename PolynomialProduct<P, Dim>::coord_type& hi
+) {
+  using R     = typename P::mapped_type;
+  using Alloc = typename std::allocator_traits<
+      typename P::allocator_type>::template rebind_alloc<R>;
+
+  auto mul     = R(1);
+  auto moments = std::vector<R, Alloc>(pp[0].get_allocator());
+  for (std::size_t axis = 0; axis != Dim; ++axis) {
+    const auto n_degrees = detail::MaxIndex(pp[axis]) + 1;
+    const auto bounds    = Eigen::Array<R, 2, 1>(lo[axis], hi[axis]);
+    moments.resize(n_degrees);
+    detail::CompleteHomogeneous(bounds, n_degrees - 1, moments.begin());
+
+    auto sum = R(0);
+    for (const auto& [index, value] : pp[axis]) {
+      sum += value * moments[index] / static_cast<R>(index + 1);
+    }
+    mul *= (hi[axis] - lo[axis]) * sum;
+  }
+  return mul;
+}
+
+/**
+ * \brief Calculate the integral of pp over a simplex.
+ * \details pp is calculated per axis at the points of the Grundmann-Moller rule which is exact for
+ * the sum of the degrees of its polynomials, so it is never expanded.
+ * \param[in] vertices a Dim x (Dim + 1) array whose columns are the vertices.
+ */
+template <class P, std::size_t Dim>
+auto IntegrateSimplex(
+    const PolynomialProduct<P, Dim>&                                      pp,
+    const CoordArrayType<typename P::mapped_type, static_cast<int>(Dim)>& vertices
+) {
+  using R = typename P::mapped_type;
+
+  const auto jacobian = detail::SimplexJacobian(vertices);
+
+  auto degree = std::size_t(0);
+  for (std::size_t axis = 0; axis != Dim; ++axis) {
+    degree += detail::MaxIndex(pp[axis]);
+  }
+  const auto sum = detail::GrundmannMoller(
+      vertices, degree, [&pp](const CoordType<R, static_cast<int>(Dim)>& x) { return Of(pp, x); }
+  );
+  return jacobian * sum;
+}
+}  // namespace mvPolynomial
+
+#endif
@@ -0,0 +1,285 @@
+#ifndef _MVPOLYNOMIAL_MULTIPLICATION_HPP_
+#define _MVPOLYNOMIAL_MULTIPLICATION_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mvPolynomial {
+/**
+ * \brief Multiply sparse polynomials by merging the streams of products with a heap.
+ * \details The products of the i-th term of the smaller operand and all terms of the larger one
+ * form the i-th stream, which is sorted if comp is a monomial order (a product of monomials keeps
+ * the order). The heap holds at most one product of each stream and the next stream is opened
+ * only after the first product of the current last stream is taken (Monagan and Pearce), so it
+ * holds at most n_small products. The products which have the same key are taken from the heap in
+ * order of their streams and combined before they are emitted, so the result is deterministic.
+ * \param[in] n_small the number of terms of the smaller operand.
+ * \param[in] n_large the number of terms of the larger operand.
+ * \param[in] product product(i, j) returns a pair of the key and the coefficient of the product of
+ * the i-th term of the smaller operand and the j-th term of the larger one.
+ * \param[in] comp comp(a, b) returns true if a key a comes before a key b.
+ * \param[in] emit emit(key, coefficient) is called for each term of the result in order of comp.
+ * \param[in] allocator an allocator which is rebound to allocate the heap.
+ */
+template <class Product, class Compare, class Emit, class Allocator = std::allocator<std::byte>>
+void HeapMultiply(
+    std::size_t      n_small,
+    std::size_t      n_large,
+    Product          product,
+    Compare          comp,
+    Emit             emit,
+    const Allocator& allocator = Allocator()
+) {
+  if (n_small == 0 || n_large == 0) {
+    return;
+  }
+
+  using Term = std::invoke_result_t<Product&, std::size_t, std::size_t>;
+  using Key  = std::remove_cvref_t<typename Term::first_type>;
+  using R    = std::remove_cvref_t<typename Term::second_type>;
+
+  struct Entry {
+    Key         key;
+    R           value;
+    std::size_t stream;
+    std::size_t position;
+  };
+
+  // std::push_heap keeps the greatest entry at the front, so an entry which comes later is less.
+  auto later = [&comp](const Entry& a, const Entry& b) {
+    if (comp(b.key, a.key)) {
+      return true;
+    }
+    if (comp(a.key, b.key)) {
+      return false;
+    }
+    return b.stream < a.stream;
+  };
+
+  using EntryAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>;
+
+  auto heap = std::vector<Entry, EntryAllocator>(allocator);
+  heap.reserve(n_small);
+  auto push = [&](std::size_t stream, std::size_t position) {
+    auto [key, value] = product(stream, position);
+    heap.push_back(Entry{std::move(key), value, stream, position});
+    std::push_heap(heap.begin(), heap.end(), later);
+  };
+  // Take the next product of the front stream and open the next stream if needed.
+  auto pop = [&]() {
+    std::pop_heap(heap.begin(), heap.end(), later);
+    auto entry = std::move(heap.back());
+    heap.pop_back();
+    if (entry.position == 0 && entry.stream + 1 != n_small) {
+      push(entry.stream + 1, 0);
+    }
+    if (entry.position + 1 != n_large) {
+      push(entry.stream, entry.position + 1);
+    }
+    return entry;
+  };
+
+  push(0, 0);
+  while (!heap.empty()) {
+    auto entry = pop();
+    auto sum   = entry.value;
+    while (!heap.empty() && !comp(entry.key, heap.front().key)) {
+      sum += pop().value;
+    }
+    emit(entry.key, sum);
+  }
+}
+
+/**
+ * \brief Multiply sparse polynomials by merging the given ranges of streams with a heap.
+ * \details Only the products of the i-th term of the smaller operand and the j-th terms of the
+ * larger one for j in ranges[i] are merged. All streams are opened at first because the first
+ * products of the ranges may not be in order of streams. The products which have the same key
+ * are combined in order of their streams as HeapMultiply without ranges.
+ * \param[in] ranges the pairs of the first and the last positions of the streams.
+ * \param[in] product product(i, j) returns a pair of the key and the coefficient of a product.
+ * \param[in] comp comp(a, b) returns true if a key a comes before a key b.
+ * \param[in] emit emit(key, coefficient) is called for each term of the result in order of comp.
+ */
+template <class Product, class Compare, class Emit>
+void HeapMultiply(
+    const std::vector<std::pair<std::size_t, std::size_t>>& ranges,
+    Product                                                  product,
+    Compare                                                  comp,
+    Emit                                                     emit
+) {
+  using Term = std::invoke_result_t<Product&, std::size_t, std::size_t>;
+  using Key  = std::remove_cvref_t<typename Term::first_type>;
+  using R    = std::remove_cvref_t<typename Term::second_type>;
+
+  struct Entry {
+    Key         key;
+    R           value;
+    std::size_t stream;
+    std::size_t position;
+  };
+
+  auto later = [&comp](const Entry& a, const Entry& b) {
+    if (comp(b.key, a.key)) {
+      return true;
+    }
+    if (comp(a.key, b.key)) {
+      return false;
+    }
+    return b.stream < a.stream;
+  };
+
+  auto heap = std::vector<Entry>();
+  heap.reserve(ranges.size());
+  for (std::size_t stream = 0; stream != ranges.size(); ++stream) {
+    if (ranges[stream].first != ranges[stream].second) {
+      auto [key, value] = product(stream, ranges[stream].first);
+      heap.push_back(Entry{std::move(key), value, stream, ranges[stream].first});
+    }
+  }
+  std::make_heap(heap.begin(), heap.end(), later);
+
+  auto pop = [&]() {
+    std::pop_heap(heap.begin(), heap.end(), later);
+    auto entry = std::move(heap.back());
+    heap.pop_back();
+    if (entry.position + 1 != ranges[entry.stream].second) {
+      auto [key, value] = product(entry.stream, entry.position + 1);
+      heap.push_back(Entry{std::move(key), value, entry.stream, entry.position + 1});
+      std::push_heap(heap.begin(), heap.end(), later);
+    }
+    return entry;
+  };
+
+  while (!heap.empty()) {
+    auto entry = pop();
+    auto sum   = entry.value;
+    while (!heap.empty() && !comp(entry.key, heap.front().key)) {
+      sum += pop().value;
+    }
+    emit(entry.key, sum);
+  }
+}
+
+/**
+ * \brief Multiply sparse polynomials on threads by splitting the keys of the products into bands.
+ * \details Splitters are chosen from samples of the products, and a band is the products between
+ * adjacent splitters. The range of each stream in a band is found by binary search since the
+ * streams are sorted. The threads take the bands one by one and merge them by HeapMultiply. The
+ * products which have the same key are in the same band and are combined in order of their
+ * streams, so the result is bit-identical to HeapMultiply for any number of threads.
+ * \param[in] n_small the number of terms of the smaller operand.
+ * \param[in] n_large the number of terms of the larger operand.
+ * \param[in] product product(i, j) returns a pair of the key and the coefficient of a product.
+ * \param[in] comp comp(a, b) returns true if a key a comes before a key b.
+ * \param[in] n_threads the number of threads.
+ * \return the terms of the bands in order of comp. The concatenation of them is the result.
+ */
+template <class Product, class Compare>
+auto ParallelHeapMultiply(
+    std::size_t n_small, std::size_t n_large, Product product, Compare comp, std::size_t n_threads
+) {
+  using Term = std::invoke_result_t<Product&, std::size_t, std::size_t>;
+  using Key  = std::remove_cvref_t<typename Term::first_type>;
+  using R    = std::remove_cvref_t<typename Term::second_type>;
+  using Band = std::vector<std::pair<Key, R>>;
+
+  n_threads = std::max<std::size_t>(n_threads, 1);
+  if (n_small == 0 || n_large == 0) {
+    return std::vector<Band>();
+  }
+
+  // Choose splitters from samples of the products. They only affect the balance of the bands.
+  const auto n_bands   = 4 * n_threads;
+  const auto n_samples = 16 * n_bands;
+  auto       samples   = std::vector<Key>();
+  samples.reserve(n_samples);
+  for (std::size_t t = 0; t != n_samples; ++t) {
+    const auto i = t * n_small / n_samples;
+    const auto j = static_cast<std::size_t>((t * 2654435761u) % n_large);
+    samples.push_back(product(i, j).first);
+  }
+  std::sort(samples.begin(), samples.end(), comp);
+  auto splitters = std::vector<Key>();
+  for (std::size_t k = 1; k != n_bands; ++k) {
+    const auto& sample = samples[k * n_samples / n_bands];
+    if (splitters.empty() || comp(splitters.back(), sample)) {
+      splitters.push_back(sample);
+    }
+  }
+
+  // positions[k][i] is the number of products of the i-th stream before the k-th splitter.
+  auto positions = std::vector<std::vector<std::size_t>>(splitters.size() + 2);
+  positions.front().assign(n_small, 0);
+  positions.back().assign(n_small, n_large);
+  for (std::size_t k = 0; k != splitters.size(); ++k) {
+    auto& position = positions[k + 1];
+    position.resize(n_small);
+    for (std::size_t i = 0; i != n_small; ++i) {
+      auto first = std::size_t(0);
+      auto count = n_large;
+      while (count > 0) {
+        const auto half = count / 2;
+        if (comp(product(i, first + half).first, splitters[k])) {
+          first += half + 1;
+          count -= half + 1;
+        } else {
+          count = half;
+        }
+      }
+      position[i] = first;
+    }
+  }
+
+  auto bands     = std::vector<Band>(positions.size() - 1);
+  auto next_band = std::atomic<std::size_t>(0);
+  auto error     = std::exception_ptr();
+  auto error_mtx = std::mutex();
+  auto work      = [&]() {
+    try {
+      auto ranges = std::vector<std::pair<std::size_t, std::size_t>>(n_small);
+      for (auto k = next_band++; k < bands.size(); k = next_band++) {
+        for (std::size_t i = 0; i != n_small; ++i) {
+          ranges[i] = {positions[k][i], positions[k + 1][i]};
+        }
+        auto& band = bands[k];
+        HeapMultiply(ranges, product, comp, [&band](const Key& key, R value) {
+          band.emplace_back(key, value);
+        });
+      }
+    } catch (...) {
+      auto lock = std::lock_guard(error_mtx);
+      error     = std::current_exception();
+    }
+  };
+
+  auto threads = std::vector<std::thread>();
+  try {
+    threads.reserve(n_threads - 1);
+    for (std::size_t t = 1; t < n_threads; ++t) {
+      threads.emplace_back(work);
+    }
+  } catch (const std::system_error&) {
+    // The threads which have started and this thread take all the bands.
+  }
+  work();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+  return bands;
+}
+}  // namespace mvPolynomial
+
+#endif
@@ -3,16 +3,27 @@
 
 #include "mvPolynomial/type.hpp"
 #include "mvPolynomial/index_comparer.hpp"
+#include "mvPolynomial/multiplication.hpp"
+#include "mvPolynomial/packed_index.hpp"
 #include "mvPolynomial/polynomial.hpp"
+#include "mvPolynomial/pow.hpp"
+#include "mvPolynomial/validation.hpp"
 
 #include <algorithm>
+#include <array>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <sstream>
+#include <thread>
 #include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "boost/container/flat_map.hpp"
-#include "boost/container/new_allocator.hpp"
 #include "boost/tuple/tuple.hpp"
 #include "boost/iterator/zip_iterator.hpp"
 #include "Eigen/Core"
@@ -24,8 +35,8 @@ template <
     std::floating_point  R,
     int                  D,
     class Comparer = IndexComparer<IntType, D>,
-    class AllocatorOrContainer =
-        boost::container::new_allocator<std::pair<IndexType<IntType, D>, R>>>
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, D>, R>>,
+    ValidationPolicy Validation = ValidateIndexes>
 class MVPolynomial {
  public:
   static_assert(D > 0, "MVPolynomial: the dimension must be greater than 0.");
@@ -80,18 +91,21 @@ class MVPolynomial {
 
   template <typename InputIterator>
   MVPolynomial(InputIterator s, InputIterator e) : index2value_(s, e) {
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
   template <typename InputIterator>
   explicit MVPolynomial(InputIterator s, InputIterator e, const allocator_type& allocator)
       : index2value_(s, e, allocator) {
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
   template <typename InputIterator>
   explicit MVPolynomial(InputIterator s, InputIterator e, const Comparer& c)
       : index2value_(s, e, c) {
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
@@ -100,6 +114,7 @@ class MVPolynomial {
       InputIterator s, InputIterator e, const Comparer& c, const allocator_type& a
   )
       : index2value_(s, e, c, a) {
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
@@ -108,6 +123,7 @@ class MVPolynomial {
       boost::container::ordered_unique_range_t o, InputIterator s, InputIterator e
   )
       : index2value_(o, s, e) {
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
@@ -119,6 +135,7 @@ class MVPolynomial {
       const Comparer&                          c
   )
       : index2value_(o, s, e, c) {
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
@@ -131,6 +148,7 @@ class MVPolynomial {
       const allocator_type&                    a
   )
       : index2value_(o, s, e, c, a) {
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
@@ -142,20 +160,50 @@ class MVPolynomial {
       const allocator_type&                    a
   )
       : index2value_(o, s, e, a) {
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
+  template <typename InputIterator>
+  explicit MVPolynomial(ordered_unique_valid_range_t o, InputIterator s, InputIterator e)
+      : index2value_(o, s, e) {
+    UpdateDegrees();
+  }
+
+  template <typename InputIterator>
+  explicit MVPolynomial(
+      ordered_unique_valid_range_t o, InputIterator s, InputIterator e, const Comparer& c
+  )
+      : index2value_(o, s, e, c) {
+    UpdateDegrees();
+  }
+
+  template <typename InputIterator>
+  explicit MVPolynomial(
+      ordered_unique_valid_range_t o,
+      InputIterator                s,
+      InputIterator                e,
+      const Comparer&              c,
+      const allocator_type&        a
+  )
+      : index2value_(o, s, e, c, a) {
+    UpdateDegrees();
+  }
+
   explicit MVPolynomial(std::initializer_list<value_type> l) : index2value_(l) {
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
   explicit MVPolynomial(std::initializer_list<value_type> l, const allocator_type& a)
       : index2value_(l, a) {
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
   explicit MVPolynomial(std::initializer_list<value_type> l, const Comparer& c)
       : index2value_(l, c) {
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
@@ -163,6 +211,7 @@ class MVPolynomial {
       std::initializer_list<value_type> l, const Comparer& c, const allocator_type& a
   )
       : index2value_(l, c, a) {
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
@@ -170,6 +219,7 @@ class MVPolynomial {
       boost::container::ordered_unique_range_t o, std::initializer_list<value_type> l
   )
       : index2value_(o, l) {
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
@@ -179,6 +229,7 @@ class MVPolynomial {
       const Comparer&                          c
   )
       : index2value_(o, l, c) {
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
@@ -189,21 +240,19 @@ class MVPolynomial {
       const allocator_type&                    a
   )
       : index2value_(o, l, c, a) {
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
   explicit MVPolynomial(const MVPolynomial& m, const allocator_type& a)
-      : index2value_(m.index2value_, a) {
-    CheckSelfIndexes();
-  }
+      : index2value_(m.index2value_, a), degrees_(m.degrees_) {}
 
   explicit MVPolynomial(MVPolynomial&& m, const allocator_type& a)
-      : index2value_(std::move(m.index2value_), a) {
-    CheckSelfIndexes();
-  }
+      : index2value_(std::move(m.index2value_), a), degrees_(m.degrees_) {}
 
   MVPolynomial& operator=(std::initializer_list<value_type> l) {
     index2value_ = l;
+    UpdateDegrees();
     CheckSelfIndexes();
     return *this;
   }
@@ -260,8 +309,14 @@ class MVPolynomial {
 
   void shrink_to_fit() { return index2value_.shrink_to_fit(); }
 
-  mapped_type& operator[](const key_type& index) { return index2value_[index]; }
-  mapped_type& operator[](key_type&& index) { return index2value_[index]; }
+  mapped_type& operator[](const key_type& index) {
+    degrees_ = degrees_.max(index);
+    return index2value_[index];
+  }
+  mapped_type& operator[](key_type&& index) {
+    degrees_ = degrees_.max(index);
+    return index2value_[index];
+  }
 
   const mapped_type& operator[](const key_type& index) const {
     return const_cast<MVPolynomial*>(this)->operator[](index);
@@ -272,25 +327,25 @@ class MVPolynomial {
 
   template <typename M>
   std::pair<iterator, bool> insert_or_assign(const key_type& i, M&& m) {
-    CheckIndex(i);
+    AddIndex(i);
     return index2value_.insert_or_assign(i, std::move(m));
   }
 
   template <typename M>
   std::pair<iterator, bool> insert_or_assign(key_type&& i, M&& m) {
-    CheckIndex(i);
+    AddIndex(i);
     return index2value_.insert_or_assign(std::move(i), std::move(m));
   }
 
   template <typename M>
   iterator insert_or_assign(const_iterator ci, const key_type& i, M&& m) {
-    CheckIndex(i);
+    AddIndex(i);
     return index2value_.insert_or_assign(ci, i, std::move(m));
   }
 
   template <typename M>
   iterator insert_or_assign(const_iterator ci, key_type&& i, M&& m) {
-    CheckIndex(i);
+    AddIndex(i);
     return index2value_.insert_or_assign(ci, std::move(i), std::move(m));
   }
 
@@ -311,7 +366,7 @@ class MVPolynomial {
   template <class... Args>
   iterator emplace_hint(const_iterator ci, Args&&... args) {
     auto iter = index2value_.emplace_hint(ci, std::move(args)...);
-    CheckIndex(iter->first);
+    AddIndex(iter->first);
     return iter;
   }
 
@@ -323,7 +378,7 @@ class MVPolynomial {
   template <class... Args>
   iterator try_emplace(const_iterator ci, const key_type& i, Args&&... args) {
     auto iter = index2value_.try_emplace(ci, i, std::move(args...));
-    CheckIndex(iter->first);
+    AddIndex(iter->first);
     return iter;
   }
 
@@ -337,7 +392,7 @@ class MVPolynomial {
   template <class... Args>
   iterator try_emplace(const_iterator ci, key_type&& i, Args&&... args) {
     auto iter = index2value_.try_emplace(ci, std::move(i), std::move(args...));
-    CheckIndex(iter->first);
+    AddIndex(iter->first);
     return iter;
   }
 
@@ -356,52 +411,75 @@ class MVPolynomial {
 
   iterator insert(const_iterator ci, const value_type& i_and_v) {
     auto iter = index2value_.insert(ci, i_and_v);
-    CheckIndex(iter->first);
+    AddIndex(iter->first);
     return iter;
   }
 
   iterator insert(const_iterator ci, value_type&& i_and_v) {
     auto iter = index2value_.insert(ci, std::move(i_and_v));
-    CheckIndex(iter->first);
+    AddIndex(iter->first);
     return iter;
   }
 
   template <class Pair>
   iterator insert(const_iterator ci, Pair&& p) {
     auto iter = index2value_.insert(ci, std::move(p));
-    CheckIndex(iter->first);
+    AddIndex(iter->first);
     return iter;
   }
 
   template <typename InputIterator>
   void insert(InputIterator s, InputIterator e) {
     index2value_.insert(s, e);
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
   template <typename InputIterator>
   void insert(boost::container::ordered_unique_range_t o, InputIterator s, InputIterator e) {
     index2value_.insert(o, s, e);
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
   void insert(std::initializer_list<value_type> l) {
     index2value_.insert(l);
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
   void insert(boost::container::ordered_unique_range_t o, std::initializer_list<value_type> l) {
     index2value_.insert(o, l);
+    UpdateDegrees();
     CheckSelfIndexes();
   }
 
-  iterator  erase(const_iterator ci) { return index2value_.erase(ci); }
-  size_type erase(const value_type& i_and_v) { return index2value_.erase(i_and_v); }
-  iterator  erase(const_iterator s, const_iterator e) { return index2value_.erase(s, e); }
+  // Erasing shifts the following terms anyway, so recalculating the degrees costs the same.
+  iterator erase(const_iterator ci) {
+    auto iter = index2value_.erase(ci);
+    UpdateDegrees();
+    return iter;
+  }
+  size_type erase(const value_type& i_and_v) {
+    auto n = index2value_.erase(i_and_v);
+    UpdateDegrees();
+    return n;
+  }
+  iterator erase(const_iterator s, const_iterator e) {
+    auto iter = index2value_.erase(s, e);
+    UpdateDegrees();
+    return iter;
+  }
 
-  void swap(MVPolynomial& m) { index2value_.swap(m.index2value_); }
+  void swap(MVPolynomial& m) {
+    index2value_.swap(m.index2value_);
+    std::swap(degrees_, m.degrees_);
+  }
 
-  void clear() noexcept { index2value_.clear(); }
+  void clear() noexcept {
+    index2value_.clear();
+    degrees_ = index_type::Zero();
+  }
 
   key_compare   key_comp() const { return index2value_.key_comp(); }
   value_compare value_comp() const { return index2value_.value_comp(); }
@@ -469,14 +547,41 @@ class MVPolynomial {
     return index2value_.equal_range(i);
   }
 
-  sequence_type extract_sequence() { return index2value_.extract_sequence(); }
+  sequence_type extract_sequence() {
+    degrees_ = index_type::Zero();
+    detail::SequenceFence();
+    return index2value_.extract_sequence();
+  }
 
-  void adopt_sequence(sequence_type&& seq) { index2value_.adopt_sequence(std::move(seq)); }
+  void adopt_sequence(sequence_type&& seq) {
+    detail::SequenceFence();
+    index2value_.adopt_sequence(std::move(seq));
+    UpdateDegrees();
+    CheckSelfIndexes();
+  }
   void adopt_sequence(boost::container::ordered_unique_range_t o, sequence_type&& seq) {
+    detail::SequenceFence();
+    index2value_.adopt_sequence(o, std::move(seq));
+    UpdateDegrees();
+    CheckSelfIndexes();
+  }
+  void adopt_sequence(ordered_unique_valid_range_t o, sequence_type&& seq) {
+    detail::SequenceFence();
     index2value_.adopt_sequence(o, std::move(seq));
+    UpdateDegrees();
   }
 
-  const sequence_type& sequence() const noexcept { return index2value_.sequence(); }
+  const sequence_type& sequence() const noexcept {
+    detail::SequenceFence();
+    return index2value_.sequence();
+  }
+
+  /**
+   * \brief Return the maximum degree of each axis over all terms.
+   * \details The members which insert or erase terms keep it up to date, so reading it costs
+   * nothing. The indexes must not be modified through iterators.
+   */
+  const index_type& degrees() const noexcept { return degrees_; }
 
   reference       front() { return *(index2value_.begin()); }
   const_reference front() const { return *(index2value_.cbegin()); }
@@ -503,6 +608,34 @@ class MVPolynomial {
     return *this;
   }
 
+  /**
+   * \brief Add r in place by merging it backward into the sequence of this polynomial.
+   * \details The sequence is only resized, so it doesn't allocate if its capacity suffices.
+   */
+  MVPolynomial& operator+=(const MVPolynomial& r) {
+    if (this == &r) {
+      return *this *= mapped_type(2);
+    }
+    MergeAssign(r, mapped_type(1));
+    return *this;
+  }
+
+  /**
+   * \brief Subtract r in place by merging it backward into the sequence of this polynomial.
+   */
+  MVPolynomial& operator-=(const MVPolynomial& r) {
+    if (this == &r) {
+      return *this *= mapped_type(0);
+    }
+    MergeAssign(r, mapped_type(-1));
+    return *this;
+  }
+
+  MVPolynomial& operator*=(const MVPolynomial& r) {
+    *this = *this * r;
+    return *this;
+  }
+
   // friend functions
   // TODO consider tolerance.
   friend bool operator==(const MVPolynomial& l, const MVPolynomial& r) {
@@ -582,8 +715,18 @@ class MVPolynomial {
   }
 
   friend MVPolynomial operator*(const MVPolynomial& l, const MVPolynomial& r) {
+    if constexpr (is_packable) {
+      if (CanPackProduct(l, r)) {
+        return PackedMultiply(l, r, 1);
+      }
+    }
+    if constexpr (is_monomial_order) {
+      return HeapMultiply(l, r, 1);
+    }
+
+    // The comparer may not keep the order of products, so sort all of them.
     auto comparer = l.key_comp();
-    auto mul      = std::vector<value_type>();
+    auto mul      = std::vector<value_type, rebind_alloc<value_type>>(l.get_allocator());
     mul.reserve(l.size() * r.size());
     // Calculate all product of each l's term and r's term.
     for (const auto& l_p : l) {
@@ -596,30 +739,214 @@ class MVPolynomial {
     std::sort(mul.begin(), mul.end(), [&comparer](const value_type& l, const value_type& r) {
       return comparer(l.first, r.first);
     });
-    auto rm_begin =
-        std::unique(mul.begin(), mul.end(), [](const value_type& l, const value_type& r) {
-          return (l.first == r.first).all();
-        });
-    // For simplicity, I make a MVPolynomial now.
-    auto mp = MVPolynomial(
-        boost::container::ordered_unique_range_t(),
-        mul.begin(),
-        rm_begin,
-        comparer,
+    // Combine the products which have the same index.
+    auto seq = sequence_type(l.get_allocator());
+    seq.reserve(mul.size());
+    for (const auto& [index, value] : mul) {
+      if (!seq.empty() && (seq.back().first == index).all()) {
+        seq.back().second += value;
+      } else {
+        seq.emplace_back(index, value);
+      }
+    }
+    return AdoptOrdered(l, std::move(seq));
+  }
+
+  /**
+   * \brief Multiply polynomials on threads.
+   * \details The products are split into bands of indexes and the threads merge the bands. The
+   * result is bit-identical to operator* for any number of threads.
+   * \param[in] n_threads the number of threads. If it is 0, std::thread::hardware_concurrency().
+   */
+  friend MVPolynomial ParallelMultiply(
+      const MVPolynomial& l, const MVPolynomial& r, std::size_t n_threads = 0
+  )
+    requires is_monomial_order
+  {
+    if (n_threads == 0) {
+      n_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    if constexpr (is_packable) {
+      if (CanPackProduct(l, r)) {
+        return PackedMultiply(l, r, n_threads);
+      }
+    }
+    return HeapMultiply(l, r, n_threads);
+  }
+
+  friend void swap(MVPolynomial& l, MVPolynomial& r) { l.swap(r); }
+
+ private:
+  // The temporaries are allocated by the allocator of the polynomials.
+  template <class T>
+  using rebind_alloc = typename std::allocator_traits<allocator_type>::template rebind_alloc<T>;
+
+  // IndexComparer keeps the order of indexes when they are added to the same index.
+  static constexpr bool is_monomial_order = std::is_same_v<Comparer, IndexComparer<IntType, D>>;
+
+  // Packed indexes are compared as integers, which is the order of IndexComparer only.
+  static constexpr bool is_packable = is_monomial_order
+                                   && std::is_same_v<index_type, IndexType<IntType, D>>
+                                   && is_packable_dim<D>;
+
+  /**
+   * \brief Return true if no element of indexes of the product overflows the packed fields.
+   */
+  static bool CanPackProduct(const MVPolynomial& l, const MVPolynomial& r)
+    requires is_packable
+  {
+    using Packer = DefaultPackedIndex<IntType, D>;
+    return ((l.degrees() + r.degrees()) <= Packer::max_element).all();
+  }
+
+  /**
+   * \brief Multiply polynomials by merging the products of each term of the smaller one.
+   */
+  static MVPolynomial HeapMultiply(
+      const MVPolynomial& l, const MVPolynomial& r, std::size_t n_threads
+  )
+    requires is_monomial_order
+  {
+    const auto& small_p = l.size() <= r.size() ? l : r;
+    const auto& large_p = l.size() <= r.size() ? r : l;
+    const auto  small   = small_p.begin();
+    const auto  large   = large_p.begin();
+
+    auto seq = sequence_type(l.get_allocator());
+    MergeProducts(
+        small_p.size(),
+        large_p.size(),
+        [small, large](std::size_t i, std::size_t j) {
+          return std::pair<index_type, R>(
+              small[i].first + large[j].first, small[i].second * large[j].second
+          );
+        },
+        l.key_comp(),
+        n_threads,
+        [&seq](const index_type& index, R value) { seq.emplace_back(index, value); },
         l.get_allocator()
     );
-    // Add duplicated elements to mp.
-    for (auto it = rm_begin; it != mul.end(); ++it) {
-      mp[it->first] += it->second;
+    return AdoptOrdered(l, std::move(seq));
+  }
+
+  /**
+   * \brief Multiply polynomials by comparing and adding packed indexes as integers.
+   */
+  static MVPolynomial PackedMultiply(
+      const MVPolynomial& l, const MVPolynomial& r, std::size_t n_threads
+  )
+    requires is_packable
+  {
+    using Packer    = DefaultPackedIndex<IntType, D>;
+    using word_type = typename Packer::word_type;
+
+    const auto& small_p = l.size() <= r.size() ? l : r;
+    const auto& large_p = l.size() <= r.size() ? r : l;
+    const auto  small   = small_p.begin();
+    const auto  large   = large_p.begin();
+
+    auto pack = [](const MVPolynomial& terms) {
+      auto words = std::vector<word_type, rebind_alloc<word_type>>(terms.get_allocator());
+      words.reserve(terms.size());
+      for (const auto& index_and_value : terms) {
+        words.push_back(Packer::Pack(index_and_value.first));
+      }
+      return words;
+    };
+    const auto small_words = pack(small_p);
+    const auto large_words = pack(large_p);
+
+    auto seq = sequence_type(l.get_allocator());
+    MergeProducts(
+        small_p.size(),
+        large_p.size(),
+        [&](std::size_t i, std::size_t j) {
+          return std::pair<word_type, R>(
+              small_words[i] + large_words[j], small[i].second * large[j].second
+          );
+        },
+        // The greater packed index comes first as IndexComparer.
+        std::greater<word_type>(),
+        n_threads,
+        [&seq](word_type word, R value) { seq.emplace_back(Packer::Unpack(word), value); },
+        l.get_allocator()
+    );
+    return AdoptOrdered(l, std::move(seq));
+  }
+
+  template <class Product, class Compare, class Emit>
+  static void MergeProducts(
+      std::size_t           n_small,
+      std::size_t           n_large,
+      Product               product,
+      Compare               comp,
+      std::size_t           n_threads,
+      Emit                  emit,
+      const allocator_type& allocator
+  ) {
+    if (n_threads <= 1) {
+      mvPolynomial::HeapMultiply(n_small, n_large, product, comp, emit, allocator);
+      return;
+    }
+    // The bands are allocated on the global heap since the allocator (ex. a monotonic arena) may
+    // not be thread-safe.
+    for (const auto& band : ParallelHeapMultiply(n_small, n_large, product, comp, n_threads)) {
+      for (const auto& [key, value] : band) {
+        emit(key, value);
+      }
     }
+  }
 
+  static MVPolynomial AdoptOrdered(const MVPolynomial& l, sequence_type&& seq) {
+    auto mp = MVPolynomial(l.key_comp(), l.get_allocator());
+    mp.adopt_sequence(ordered_unique_valid_range, std::move(seq));
     return mp;
   }
 
-  friend void swap(MVPolynomial& l, MVPolynomial& r) { swap(l.index2value_, r.index2value_); }
+  /**
+   * \brief Merge sign * r into this polynomial from the last terms.
+   */
+  void MergeAssign(const MVPolynomial& r, mapped_type sign) {
+    const auto comparer = key_comp();
+    auto       seq      = extract_sequence();
+
+    // Count the terms of r which this polynomial doesn't have.
+    auto n_new = size_type(0);
+    auto l_it  = seq.cbegin();
+    for (const auto& r_p : r) {
+      while (l_it != seq.cend() && comparer(l_it->first, r_p.first)) {
+        ++l_it;
+      }
+      if (l_it == seq.cend() || comparer(r_p.first, l_it->first)) {
+        ++n_new;
+      }
+    }
+
+    auto i = seq.size();
+    seq.resize(seq.size() + n_new);
+    auto k = seq.size();
+    auto j = r.size();
+    // Move the last of the rest terms to the back until all terms of r are merged.
+    while (j != 0) {
+      const auto& [r_idx, r_v] = *(r.begin() + (j - 1));
+      if (i != 0 && comparer(r_idx, seq[i - 1].first)) {
+        seq[--k] = std::move(seq[--i]);
+      } else if (i != 0 && !comparer(seq[i - 1].first, r_idx)) {
+        --i;
+        seq[--k] = value_type(std::move(seq[i].first), seq[i].second + sign * r_v);
+        --j;
+      } else {
+        seq[--k] = value_type(r_idx, sign * r_v);
+        --j;
+      }
+    }
+    adopt_sequence(ordered_unique_valid_range, std::move(seq));
+  }
 
- private:
   void CheckIndex(const key_type& index) const {
+    if constexpr (!Validation::validates) {
+      return;
+    }
     if ((index < index_type::Zero()).any()) {
       auto err_msg_stream = std::stringstream();
       for (auto i = 0; i != index.size() - 1; ++i) {
@@ -633,7 +960,22 @@ class MVPolynomial {
     }
   }
 
+  void AddIndex(const key_type& index) {
+    degrees_ = degrees_.max(index);
+    CheckIndex(index);
+  }
+
+  void UpdateDegrees() {
+    degrees_ = index_type::Zero();
+    for (const auto& index_and_value : index2value_) {
+      degrees_ = degrees_.max(index_and_value.first);
+    }
+  }
+
   void CheckSelfIndexes() const {
+    if constexpr (!Validation::validates) {
+      return;
+    }
     for (const auto& index_and_value : index2value_) {
       const auto& [index, value] = index_and_value;
       CheckIndex(index);
@@ -645,7 +987,7 @@ class MVPolynomial {
   ) {
     const auto& [iter, is_inserted] = iter_and_is_inserted;
     if (is_inserted) {
-      CheckIndex(iter->first);
+      AddIndex(iter->first);
     }
     return iter_and_is_inserted;
   }
@@ -653,26 +995,31 @@ class MVPolynomial {
   IndexContainer index2value_{
       {index_type::Zero(), 0}
   };
+  // The maximum degree of each axis, which sizes the tables of powers of Of.
+  index_type degrees_{index_type::Zero()};
 };
 
 template <
     std::signed_integral IntType,
     class R,
     int D,
-    class AllocatorOrContainer =
-        boost::container::new_allocator<std::pair<IndexType<IntType, D>, R>>>
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, D>, R>>,
+    class Validation = ValidateIndexes>
 using DefaultMVPolynomial =
-    MVPolynomial<IntType, R, D, IndexComparer<IntType, D>, AllocatorOrContainer>;
+    MVPolynomial<IntType, R, D, IndexComparer<IntType, D>, AllocatorOrContainer, Validation>;
 
 template <
     std::signed_integral IntType,
     class R,
     int Dim,
     class Comparer,
-    class AllocatorOrContainer =
-        boost::container::new_allocator<std::pair<IndexType<IntType, Dim>, R>>>
-auto D(const MVPolynomial<IntType, R, Dim, Comparer, AllocatorOrContainer>& p, std::size_t axis) {
-  using MP = MVPolynomial<IntType, R, Dim, Comparer, AllocatorOrContainer>;
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, Dim>, R>>,
+    class Validation = ValidateIndexes>
+auto D(
+    const MVPolynomial<IntType, R, Dim, Comparer, AllocatorOrContainer, Validation>& p,
+    std::size_t                                                                      axis
+) {
+  using MP = MVPolynomial<IntType, R, Dim, Comparer, AllocatorOrContainer, Validation>;
 
   MP::CheckAxis(axis);
 
@@ -696,23 +1043,22 @@ auto D(const MVPolynomial<IntType, R, Dim, Comparer, AllocatorOrContainer>& p, s
         return comparer(l.first, r.first);
       }
   );
-  return MP(
-      boost::container::ordered_unique_range_t(),
-      new_index2value_seq.begin(),
-      new_index2value_seq.end(),
-      comparer,
-      p.get_allocator()
-  );
+  auto d = MP(comparer, p.get_allocator());
+  d.adopt_sequence(ordered_unique_valid_range, std::move(new_index2value_seq));
+  return d;
 }
 
 template <
     std::signed_integral IntType,
     class R,
     int Dim,
-    class AllocatorOrContainer =
-        boost::container::new_allocator<std::pair<IndexType<IntType, Dim>, R>>>
-auto D(const DefaultMVPolynomial<IntType, R, Dim, AllocatorOrContainer>& p, std::size_t axis) {
-  using MP = DefaultMVPolynomial<IntType, R, Dim, AllocatorOrContainer>;
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, Dim>, R>>,
+    class Validation = ValidateIndexes>
+auto D(
+    const DefaultMVPolynomial<IntType, R, Dim, AllocatorOrContainer, Validation>& p,
+    std::size_t                                                                   axis
+) {
+  using MP = DefaultMVPolynomial<IntType, R, Dim, AllocatorOrContainer, Validation>;
 
   MP::CheckAxis(axis);
 
@@ -743,13 +1089,9 @@ auto D(const DefaultMVPolynomial<IntType, R, Dim, AllocatorOrContainer>& p, std:
       ++p_it;
     }
   }
-  return MP(
-      boost::container::ordered_unique_range_t(),
-      new_index2value_seq.begin(),
-      new_index2value_seq.end(),
-      p.key_comp(),
-      p.get_allocator()
-  );
+  auto d = MP(p.key_comp(), p.get_allocator());
+  d.adopt_sequence(ordered_unique_valid_range, std::move(new_index2value_seq));
+  return d;
 }
 
 template <
@@ -757,10 +1099,12 @@ template <
     class R,
     int D,
     class Comparer = IndexComparer<IntType, D>,
-    class AllocatorOrContainer =
-        boost::container::new_allocator<std::pair<IndexType<IntType, D>, R>>>
-auto Integrate(MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer>&& p, std::size_t axis) {
-  using MP = MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer>;
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, D>, R>>,
+    class Validation = ValidateIndexes>
+auto Integrate(
+    MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>&& p, std::size_t axis
+) {
+  using MP = MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>;
 
   MP::CheckAxis(axis);
 
@@ -777,7 +1121,7 @@ auto Integrate(MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer>&& p,
         return comparer(l.first, r.first);
       }
   );
-  p.adopt_sequence(std::move(index2value));
+  p.adopt_sequence(ordered_unique_valid_range, std::move(index2value));
   return std::move(p);
 }
 
@@ -786,12 +1130,42 @@ template <
     class R,
     int D,
     class Comparer = IndexComparer<IntType, D>,
-    class AllocatorOrContainer =
-        boost::container::new_allocator<std::pair<IndexType<IntType, D>, R>>>
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, D>, R>>,
+    class Validation = ValidateIndexes>
 auto Integrate(
-    const MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer>& p, std::size_t axis
+    const MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>& p,
+    std::size_t                                                                    axis
 ) {
-  return Integrate(MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer>(p), axis);
+  using MP = MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>;
+  return Integrate(MP(p), axis);
+}
+
+/**
+ * \brief Tabulate x_k^0, ..., x_k^{degrees_k} of each axis of p one after another by repeated
+ * multiplication.
+ * \return the offset of the table of each axis and the tables, which are allocated by the
+ * allocator of p.
+ */
+template <class Polynomial>
+auto MakePowerTables(const Polynomial& p, const typename Polynomial::coord_type& x) {
+  using Scalar = typename Polynomial::mapped_type;
+  using Alloc  = typename std::allocator_traits<
+      typename Polynomial::allocator_type>::template rebind_alloc<Scalar>;
+
+  const auto& degrees  = p.degrees();
+  auto        offsets  = std::array<std::size_t, Polynomial::dim>();
+  auto        n_powers = std::size_t(0);
+  for (int axis = 0; axis != Polynomial::dim; ++axis) {
+    offsets[axis] = n_powers;
+    n_powers += static_cast<std::size_t>(degrees[axis]) + 1;
+  }
+  auto powers = std::vector<Scalar, Alloc>(n_powers, Scalar(1), p.get_allocator());
+  for (int axis = 0; axis != Polynomial::dim; ++axis) {
+    for (std::size_t k = 1; k <= static_cast<std::size_t>(degrees[axis]); ++k) {
+      powers[offsets[axis] + k] = powers[offsets[axis] + k - 1] * x[axis];
+    }
+  }
+  return std::make_pair(offsets, std::move(powers));
 }
 
 template <
@@ -799,21 +1173,157 @@ template <
     class R,
     int D,
     class Comparer,
-    class AllocatorOrContainer =
-        boost::container::new_allocator<std::pair<IndexType<IntType, D>, R>>>
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, D>, R>>,
+    class Validation = ValidateIndexes>
 auto Of(
-    const MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer>&                      p,
-    const typename MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer>::coord_type& x
+    const MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>& p,
+    const typename MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>::
+        coord_type& x
 ) {
-  using MP                     = MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer>;
+  using MP = MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>;
+
+  // Each term is D lookups instead of D calls of pow.
+  const auto [offsets, powers] = MakePowerTables(p, x);
   typename MP::mapped_type sum = 0;
   for (const auto& index_and_value : p) {
     const auto& [index, value] = index_and_value;
-    sum += value * (x.array().pow(index.template cast<typename MP::mapped_type>())).prod();
+    auto monomial              = value;
+    for (int axis = 0; axis != D; ++axis) {
+      monomial *= powers[offsets[axis] + index[axis]];
+    }
+    sum += monomial;
   }
   return sum;
 }
 
+template <
+    std::signed_integral IntType,
+    class R,
+    int D,
+    class Comparer,
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, D>, R>>,
+    class Validation = ValidateIndexes,
+    class Derived>
+  requires(Derived::RowsAtCompileTime == D && Derived::ColsAtCompileTime == Eigen::Dynamic)
+auto Of(
+    const MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>& p,
+    const Eigen::ArrayBase<Derived>&                                               xs
+) {
+  ValueArrayType<R> values = ValueArrayType<R>::Zero(xs.cols());
+  for (const auto& index_and_value : p) {
+    const auto& [index, value] = index_and_value;
+    ValueArrayType<R> monomial = ValueArrayType<R>::Constant(xs.cols(), value);
+    for (int axis = 0; axis != D; ++axis) {
+      monomial *= Pow(xs.row(axis), index[axis]);
+    }
+    values += monomial;
+  }
+  return values;
+}
+
+/**
+ * \brief Calculate the value and the gradient of p at x in one pass over the terms.
+ * \details The derivative of each factor x_k^i is i * x_k^{i-1}, which is in the tables of powers,
+ * and the products of the other factors are the products of prefixes and suffixes, so neither the
+ * derivatives of p nor divisions by x_k are needed.
+ */
+template <
+    std::signed_integral IntType,
+    class R,
+    int D,
+    class Comparer,
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, D>, R>>,
+    class Validation = ValidateIndexes>
+auto ValueAndGradient(
+    const MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>& p,
+    const typename MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>::
+        coord_type& x
+) {
+  using MP = MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>;
+
+  const auto [offsets, powers] = MakePowerTables(p, x);
+
+  typename MP::mapped_type value    = 0;
+  typename MP::coord_type  gradient = MP::coord_type::Zero();
+  // prefixes[k] is the product of the factors before axis k and suffixes[k] is that from axis k.
+  auto prefixes = std::array<typename MP::mapped_type, D + 1>();
+  auto suffixes = std::array<typename MP::mapped_type, D + 1>();
+  for (const auto& [index, coeff] : p) {
+    prefixes[0] = suffixes[D] = 1;
+    for (int axis = 0; axis != D; ++axis) {
+      prefixes[axis + 1] = prefixes[axis] * powers[offsets[axis] + index[axis]];
+      suffixes[D - 1 - axis] =
+          suffixes[D - axis] * powers[offsets[D - 1 - axis] + index[D - 1 - axis]];
+    }
+    value += coeff * prefixes[D];
+    for (int axis = 0; axis != D; ++axis) {
+      if (index[axis] != 0) {
+        gradient[axis] += coeff * index[axis] * powers[offsets[axis] + index[axis] - 1]
+                        * prefixes[axis] * suffixes[axis + 1];
+      }
+    }
+  }
+  return std::make_pair(value, gradient);
+}
+
+/**
+ * \brief Calculate the value, the gradient and the Hessian of p at x in one pass over the terms.
+ * \details It is ValueAndGradient which also multiplies the derivatives of each pair of factors
+ * by the product of the other factors.
+ */
+template <
+    std::signed_integral IntType,
+    class R,
+    int D,
+    class Comparer,
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, D>, R>>,
+    class Validation = ValidateIndexes>
+auto ValueGradientAndHessian(
+    const MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>& p,
+    const typename MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>::
+        coord_type& x
+) {
+  using MP     = MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>;
+  using Scalar = typename MP::mapped_type;
+
+  const auto [offsets, powers] = MakePowerTables(p, x);
+
+  Scalar                  value    = 0;
+  typename MP::coord_type gradient = MP::coord_type::Zero();
+  HessianType<Scalar, D>  hessian  = HessianType<Scalar, D>::Zero();
+
+  auto prefixes    = std::array<Scalar, D + 1>();
+  auto suffixes    = std::array<Scalar, D + 1>();
+  auto derivatives = std::array<Scalar, D>();
+  for (const auto& [index, coeff] : p) {
+    prefixes[0] = suffixes[D] = 1;
+    for (int axis = 0; axis != D; ++axis) {
+      prefixes[axis + 1] = prefixes[axis] * powers[offsets[axis] + index[axis]];
+      suffixes[D - 1 - axis] =
+          suffixes[D - axis] * powers[offsets[D - 1 - axis] + index[D - 1 - axis]];
+      derivatives[axis] =
+          index[axis] == 0 ? Scalar(0) : index[axis] * powers[offsets[axis] + index[axis] - 1];
+    }
+    value += coeff * prefixes[D];
+    for (int k = 0; k != D; ++k) {
+      gradient[k] += coeff * derivatives[k] * prefixes[k] * suffixes[k + 1];
+      if (index[k] > 1) {
+        hessian(k, k) += coeff * index[k] * (index[k] - 1) * powers[offsets[k] + index[k] - 2]
+                       * prefixes[k] * suffixes[k + 1];
+      }
+      // between is the product of the factors between axis k and axis l.
+      auto between = Scalar(1);
+      for (int l = k + 1; l != D; ++l) {
+        hessian(k, l) += coeff * derivatives[k] * derivatives[l] * prefixes[k] * between
+                       * suffixes[l + 1];
+        between *= powers[offsets[l] + index[l]];
+      }
+    }
+  }
+  hessian.template triangularView<Eigen::StrictlyLower>() = hessian.transpose();
+  return std::make_tuple(value, gradient, hessian);
+}
+
 template <class Iterator, class Coord>
 auto OfImpl(Iterator begin, Iterator end, int dim, std::size_t axis, const Coord& x) {
   assert(axis >= 0 && axis < dim);
@@ -821,11 +1331,13 @@ auto OfImpl(Iterator begin, Iterator end, int dim, std::size_t axis, const Coord
     auto [last_index, last_coeff] = *begin;
     for (auto it = std::next(begin); it != end; ++it) {
       const auto& [next_index, next_coeff] = *it;
-      last_coeff *= std::pow(x[axis], last_index[axis] - next_index[axis]);
+      last_coeff *= Pow(x[axis], last_index[axis] - next_index[axis]);
       last_coeff += next_coeff;
       last_index = next_index;
     }
-    last_coeff *= x.pow(last_index.template cast<typename Coord::Scalar>()).prod();
+    for (int ith_axis = 0; ith_axis != dim; ++ith_axis) {
+      last_coeff *= Pow(x[ith_axis], last_index[ith_axis]);
+    }
     return last_coeff;
   } else {
     auto sum = typename Iterator::value_type::second_type(0);
@@ -854,16 +1366,72 @@ template <
     std::signed_integral IntType,
     class R,
     int D,
-    class AllocatorOrContainer =
-        boost::container::new_allocator<std::pair<IndexType<IntType, D>, R>>>
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, D>, R>>,
+    class Validation = ValidateIndexes>
 auto Of(
-    const DefaultMVPolynomial<IntType, R, D, AllocatorOrContainer>&                      p,
-    const typename DefaultMVPolynomial<IntType, R, D, AllocatorOrContainer>::coord_type& x
+    const DefaultMVPolynomial<IntType, R, D, AllocatorOrContainer, Validation>& p,
+    const typename DefaultMVPolynomial<IntType, R, D, AllocatorOrContainer, Validation>::
+        coord_type& x
 ) {
-  using MP = DefaultMVPolynomial<IntType, R, D, AllocatorOrContainer>;
+  using MP = DefaultMVPolynomial<IntType, R, D, AllocatorOrContainer, Validation>;
   return OfImpl(p.cbegin(), p.cend(), MP::dim, 0, x);
 }
 
+template <class Iterator, class Coords>
+auto BatchOfImpl(Iterator begin, Iterator end, int dim, std::size_t axis, const Coords& xs) {
+  using Scalar = typename Coords::Scalar;
+  assert(axis < static_cast<std::size_t>(dim));
+  if (axis == static_cast<std::size_t>(dim) - 1) {
+    // Walk the terms once and run Horner's method on all points at once.
+    auto last_index               = begin->first;
+    ValueArrayType<Scalar> values = ValueArrayType<Scalar>::Constant(xs.cols(), begin->second);
+    for (auto it = std::next(begin); it != end; ++it) {
+      const auto& [next_index, next_coeff] = *it;
+      values     = values * Pow(xs.row(axis), last_index[axis] - next_index[axis]) + next_coeff;
+      last_index = next_index;
+    }
+    for (int ith_axis = 0; ith_axis != dim; ++ith_axis) {
+      values *= Pow(xs.row(ith_axis), last_index[ith_axis]);
+    }
+    return values;
+  } else {
+    ValueArrayType<Scalar> sum = ValueArrayType<Scalar>::Zero(xs.cols());
+    while (true) {
+      const auto& [first_index, first_coeff] = *begin;
+      auto partition_point                   = std::partition_point(
+          begin,
+          end,
+          [axis, &first_index](const typename Iterator::value_type& pair) {
+            return pair.first[axis] == first_index[axis];
+          }
+      );
+      sum += BatchOfImpl(begin, partition_point, dim, axis + 1, xs);
+      if (partition_point == end) {
+        // The calculation ends.
+        break;
+      }
+      begin = partition_point;
+    }
+    return sum;
+  }
+}
+
+template <
+    std::signed_integral IntType,
+    class R,
+    int D,
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, D>, R>>,
+    class Validation = ValidateIndexes,
+    class Derived>
+  requires(Derived::RowsAtCompileTime == D && Derived::ColsAtCompileTime == Eigen::Dynamic)
+auto Of(
+    const DefaultMVPolynomial<IntType, R, D, AllocatorOrContainer, Validation>& p,
+    const Eigen::ArrayBase<Derived>&                                            xs
+) {
+  using MP = DefaultMVPolynomial<IntType, R, D, AllocatorOrContainer, Validation>;
+  return BatchOfImpl(p.cbegin(), p.cend(), MP::dim, 0, xs.derived());
+}
+
 template <template <class, int> class Array, class IntType, int D>
 auto MakeSubIndex(const Array<IntType, D>& index) {
   auto projected_index = Array<IntType, D - 1>();
@@ -875,12 +1443,32 @@ auto MakeSubIndex(const Array<IntType, D>& index) {
   return projected_index;
 }
 
+/**
+ * \brief Throw an exception if the number of coefficients differs from that of terms.
+ */
+inline void CheckCoefficientSize(std::size_t n_terms, std::size_t n_coeffs) {
+  if (n_terms != n_coeffs) {
+    throw std::runtime_error(
+        fmt::format("The number of coefficients {} must be that of terms {}.", n_coeffs, n_terms)
+    );
+  }
+}
+
+/**
+ * \brief Make an array of N containers which use the allocator.
+ */
+template <class Container, std::size_t N, class Allocator>
+std::array<Container, N> MakeArray(const Allocator& allocator) {
+  return [&allocator]<std::size_t... I>(std::index_sequence<I...>) {
+    return std::array<Container, N>{((void)I, Container(allocator))...};
+  }(std::make_index_sequence<N>());
+}
+
 template <
     std::signed_integral IntType,
     class R,
     int D,
-    class AllocatorOrContainer =
-        boost::container::new_allocator<std::pair<IndexType<IntType, D>, R>>>
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, D>, R>>>
 class ExactOf {
  public:
   static_assert(D > 2);
@@ -889,12 +1477,30 @@ class ExactOf {
 
   using alloc_traits    = std::allocator_traits<AllocatorOrContainer>;
   using polynomial_type = DefaultMVPolynomial<IntType, R, dim, AllocatorOrContainer>;
-  using partition_type  = std::vector<typename polynomial_type::const_iterator>;
+  using partition_type  = std::vector<
+      typename polynomial_type::const_iterator,
+      typename alloc_traits::template rebind_alloc<typename polynomial_type::const_iterator>>;
+
+  using coeff_vector_type    = std::vector<R, typename alloc_traits::template rebind_alloc<R>>;
+  using position_vector_type =
+      std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
 
   using projected_polynomial_alloc_type =
       typename alloc_traits::rebind_alloc<std::pair<IndexType<IntType, dim - 1>, R>>;
   using projected_polynomial_type =
       DefaultMVPolynomial<IntType, R, dim - 1, projected_polynomial_alloc_type>;
+  using projection_type = ExactOf<IntType, R, dim - 1, projected_polynomial_alloc_type>;
+
+  /**
+   * \brief Scratch memory of the const evaluation, which each thread owns.
+   * \details It holds the coefficients of the projection, their derivatives along the last axis
+   * and the workspace of the projection.
+   */
+  struct Workspace {
+    coeff_vector_type                   coeffs;
+    coeff_vector_type                   derivatives;
+    typename projection_type::Workspace projection;
+  };
 
   explicit ExactOf(polynomial_type&& p) { set_polynomial(std::move(p)); }
 
@@ -908,12 +1514,59 @@ class ExactOf {
   virtual ~ExactOf()                       = default;
 
   auto operator()(const typename polynomial_type::coord_type& x) {
-    for (auto partition_it = partition_.begin(); partition_it != std::prev(partition_.end());
-         ++partition_it) {
-      projection_.get_polynomial_coeff(MakeSubIndex<IndexType>((*partition_it)->first)) =
-          Calculate(*partition_it, *(std::next(partition_it)), dim - 1, x);
-    }
-    return projection_(MakeSubIndex<CoordType>(x));
+    return (*this)(x, workspace_);
+  }
+
+  /**
+   * \brief Calculate f of x with the scratch memory in workspace.
+   * \details It doesn't modify this object, so threads can share it if each thread has its own
+   * workspace made by make_workspace().
+   */
+  R operator()(const typename polynomial_type::coord_type& x, Workspace& workspace) const {
+    const auto terms = polynomial_.cbegin();
+    return Evaluate([terms](std::size_t k) { return terms[k].second; }, x, workspace);
+  }
+
+  /**
+   * \brief Make a workspace of the const evaluation, which is allocated by the allocator of the
+   * polynomial.
+   */
+  Workspace make_workspace() const {
+    const auto n_partitions = partition_.empty() ? 0 : partition_.size() - 1;
+    return Workspace{
+        coeff_vector_type(n_partitions, R(0), polynomial_.get_allocator()),
+        coeff_vector_type(n_partitions, R(0), polynomial_.get_allocator()),
+        projection_.make_workspace()
+    };
+  }
+
+  /**
+   * \brief Calculate the value and the gradient at x in one pass.
+   * \details Horner's method along the last axis also calculates the derivatives of the
+   * coefficients of the projection. The projection calculates the value and the gradient of the
+   * other axes from the coefficients and the derivative along the last axis from their
+   * derivatives.
+   */
+  auto value_and_gradient(const typename polynomial_type::coord_type& x) {
+    return value_and_gradient(x, workspace_);
+  }
+
+  /**
+   * \brief Calculate the value and the gradient at x with the scratch memory in workspace.
+   * \details It doesn't modify this object, so threads can share it if each thread has its own
+   * workspace made by make_workspace().
+   */
+  auto value_and_gradient(
+      const typename polynomial_type::coord_type& x, Workspace& workspace
+  ) const {
+    const auto terms = polynomial_.cbegin();
+    return ValueAndGradient([terms](std::size_t k) { return terms[k].second; }, x, workspace);
+  }
+
+  template <class Derived>
+    requires(Derived::RowsAtCompileTime == dim && Derived::ColsAtCompileTime == Eigen::Dynamic)
+  auto operator()(const Eigen::ArrayBase<Derived>& xs) const {
+    return Of(polynomial_, xs);
   }
 
   const auto& get_polynomial() const { return polynomial_; }
@@ -926,29 +1579,101 @@ class ExactOf {
     polynomial_ = std::move(p);
 
     // Make a partition from polynomial_.
-    std::array<partition_type, dim - 1> partitions;
+    const auto allocator  = polynomial_.get_allocator();
+    auto       partitions = MakeArray<partition_type, dim - 1>(allocator);
     MakePartitions(polynomial_, partitions);
-    partition_ = partitions.back();
+    // Keep the positions of the partitions, which stay valid when this object is copied.
+    partition_ = position_vector_type(allocator);
+    partition_.reserve(partitions.back().size());
+    for (const auto& polynomial_const_it : partitions.back()) {
+      partition_.push_back(std::distance(polynomial_.cbegin(), polynomial_const_it));
+    }
 
-    // Make a projected polynomial.
-    auto projected_polynomial = projected_polynomial_type();
-    projected_polynomial.clear();
+    // Make a projected polynomial. The indexes are parts of the valid ones in order.
+    auto projected_seq = typename projected_polynomial_type::sequence_type(allocator);
+    projected_seq.reserve(partition_.size() - 1);
     for (const auto& polynomial_const_it :
-         std::ranges::subrange(partition_.begin(), std::prev(partition_.end()))) {
-      projected_polynomial.emplace_hint(
-          projected_polynomial.end(),
-          MakeSubIndex<IndexType>(polynomial_const_it->first),
-          0
-      );
+         std::ranges::subrange(partitions.back().begin(), std::prev(partitions.back().end()))) {
+      projected_seq.emplace_back(MakeSubIndex<IndexType>(polynomial_const_it->first), 0);
     }
+    auto projected_polynomial =
+        projected_polynomial_type(projected_polynomial_alloc_type(allocator));
+    projected_polynomial.adopt_sequence(ordered_unique_valid_range, std::move(projected_seq));
     projection_.set_polynomial(std::move(projected_polynomial));
+
+    workspace_ = make_workspace();
   }
 
   void set_polynomial(const polynomial_type& p) { set_polynomial(polynomial_type(p)); }
 
+  /**
+   * \brief Replace the coefficients in order of the terms.
+   * \details The indexes and the partitions are kept, so it is a copy of the coefficients.
+   */
+  void set_coefficients(std::span<const R> coeffs) {
+    CheckCoefficientSize(polynomial_.size(), coeffs.size());
+    auto coeff_it = coeffs.begin();
+    for (auto& index_and_value : polynomial_) {
+      index_and_value.second = *coeff_it++;
+    }
+  }
+
   auto move_polynomial() { return std::move(polynomial_); }
 
  private:
+  template <std::signed_integral, class, int, class>
+  friend class ExactOf;
+
+  /**
+   * \brief Calculate f of x whose k-th coefficient is coeff(k).
+   */
+  template <class Coeff>
+  R Evaluate(
+      Coeff coeff, const typename polynomial_type::coord_type& x, Workspace& workspace
+  ) const {
+    for (std::size_t k = 0; k + 1 < partition_.size(); ++k) {
+      workspace.coeffs[k] = Calculate(partition_[k], partition_[k + 1], coeff, x);
+    }
+    const auto& coeffs = workspace.coeffs;
+    return projection_.Evaluate(
+        [&coeffs](std::size_t k) { return coeffs[k]; },
+        MakeSubIndex<CoordType>(x),
+        workspace.projection
+    );
+  }
+
+  /**
+   * \brief Calculate the value and the gradient at x of f whose k-th coefficient is coeff(k).
+   * \details Horner's method along the last axis also calculates the derivatives of the
+   * coefficients of the projection. The projection calculates the value and the gradient of the
+   * other axes from the coefficients and the derivative along the last axis from their
+   * derivatives.
+   */
+  template <class Coeff>
+  auto ValueAndGradient(
+      Coeff coeff, const typename polynomial_type::coord_type& x, Workspace& workspace
+  ) const {
+    for (std::size_t k = 0; k + 1 < partition_.size(); ++k) {
+      const auto [value, derivative] =
+          CalculateWithDerivative(partition_[k], partition_[k + 1], coeff, x);
+      workspace.coeffs[k]      = value;
+      workspace.derivatives[k] = derivative;
+    }
+    const auto& coeffs               = workspace.coeffs;
+    const auto& derivatives          = workspace.derivatives;
+    const auto  sub_x                = MakeSubIndex<CoordType>(x);
+    const auto [value, sub_gradient] = projection_.ValueAndGradient(
+        [&coeffs](std::size_t k) { return coeffs[k]; }, sub_x, workspace.projection
+    );
+
+    auto gradient                     = typename polynomial_type::coord_type();
+    gradient.template head<dim - 1>() = sub_gradient;
+    gradient[dim - 1]                 = projection_.Evaluate(
+        [&derivatives](std::size_t k) { return derivatives[k]; }, sub_x, workspace.projection
+    );
+    return std::make_pair(value, gradient);
+  }
+
   void MakePartitions(
       const polynomial_type& polynomial, std::array<partition_type, dim - 1>& partitions
   ) {
@@ -1009,28 +1734,61 @@ class ExactOf {
     }
   }
 
-  template <class Iterator>
-  auto Calculate(
-      Iterator cbegin, Iterator cend, int axis, const typename polynomial_type::coord_type& x
+  /**
+   * \brief Calculate the coefficient of the projection from the terms in [first, last) by
+   * Horner's method along the last axis.
+   */
+  template <class Coeff>
+  R Calculate(
+      std::size_t                                 first,
+      std::size_t                                 last,
+      Coeff                                       coeff,
+      const typename polynomial_type::coord_type& x
   ) const {
-    auto [last_index, last_coeff] = *cbegin;
-    std::for_each(
-        std::next(cbegin),
-        cend,
-        [&last_coeff, &last_index, &x, axis](const typename polynomial_type::value_type& i_and_c) {
-          const auto& [next_index, next_coeff] = i_and_c;
-          last_coeff *= std::pow(x[axis], last_index[axis] - next_index[axis]);
-          last_coeff += next_coeff;
-          last_index = next_index;
-        }
-    );
-    last_coeff *= std::pow(x[axis], last_index[axis]);
+    constexpr int axis       = dim - 1;
+    const auto    terms      = polynomial_.cbegin();
+    auto          last_index = terms[first].first[axis];
+    auto          last_coeff = coeff(first);
+    for (auto k = first + 1; k != last; ++k) {
+      const auto next_index = terms[k].first[axis];
+      last_coeff *= Pow(x[axis], last_index - next_index);
+      last_coeff += coeff(k);
+      last_index = next_index;
+    }
+    last_coeff *= Pow(x[axis], last_index);
     return last_coeff;
   }
 
-  polynomial_type                                             polynomial_;
-  partition_type                                              partition_;
-  ExactOf<IntType, R, D - 1, projected_polynomial_alloc_type> projection_;
+  /**
+   * \brief Calculate the same as Calculate and its derivative along the last axis.
+   */
+  template <class Coeff>
+  std::pair<R, R> CalculateWithDerivative(
+      std::size_t                                 first,
+      std::size_t                                 last,
+      Coeff                                       coeff,
+      const typename polynomial_type::coord_type& x
+  ) const {
+    constexpr int axis            = dim - 1;
+    const auto    terms           = polynomial_.cbegin();
+    auto          last_index      = terms[first].first[axis];
+    auto          last_coeff      = coeff(first);
+    auto          last_derivative = R(0);
+    for (auto k = first + 1; k != last; ++k) {
+      const auto next_index = terms[k].first[axis];
+      HornerStep(last_coeff, last_derivative, x[axis], last_index - next_index);
+      last_coeff += coeff(k);
+      last_index = next_index;
+    }
+    HornerStep(last_coeff, last_derivative, x[axis], last_index);
+    return std::make_pair(last_coeff, last_derivative);
+  }
+
+  polynomial_type      polynomial_;
+  position_vector_type partition_;
+  projection_type      projection_;
+  // The workspace of the non-const evaluation.
+  Workspace workspace_;
 };
 
 template <std::signed_integral IntType, class R, class AllocatorOrContainer>
@@ -1040,11 +1798,27 @@ class ExactOf<IntType, R, 2, AllocatorOrContainer> {
 
   using alloc_traits    = std::allocator_traits<AllocatorOrContainer>;
   using polynomial_type = DefaultMVPolynomial<IntType, R, dim, AllocatorOrContainer>;
-  using partition_type  = std::vector<typename polynomial_type::const_iterator>;
+  using partition_type  = std::vector<
+      typename polynomial_type::const_iterator,
+      typename alloc_traits::template rebind_alloc<typename polynomial_type::const_iterator>>;
+
+  using coeff_vector_type    = std::vector<R, typename alloc_traits::template rebind_alloc<R>>;
+  using position_vector_type =
+      std::vector<std::size_t, typename alloc_traits::template rebind_alloc<std::size_t>>;
 
   using projected_polynomial_alloc_type =
       typename alloc_traits::rebind_alloc<std::pair<IntType, R>>;
   using projected_polynomial_type = DefaultPolynomial<IntType, R, projected_polynomial_alloc_type>;
+  using projection_type           = ExactOf<IntType, R, 1, projected_polynomial_alloc_type>;
+
+  /**
+   * \brief Scratch memory of the const evaluation, which each thread owns.
+   */
+  struct Workspace {
+    coeff_vector_type                   coeffs;
+    coeff_vector_type                   derivatives;
+    typename projection_type::Workspace projection;
+  };
 
   explicit ExactOf(polynomial_type&& p) { set_polynomial(std::move(p)); }
 
@@ -1058,12 +1832,53 @@ class ExactOf<IntType, R, 2, AllocatorOrContainer> {
   virtual ~ExactOf()                       = default;
 
   auto operator()(const typename polynomial_type::coord_type& x) {
-    for (auto partition_it = partition_.begin(); partition_it != std::prev(partition_.end());
-         ++partition_it) {
-      projection_.get_polynomial_coeff((*partition_it)->first[0]) =
-          Calculate(*partition_it, *(std::next(partition_it)), dim - 1, x);
-    }
-    return projection_(x[0]);
+    return (*this)(x, workspace_);
+  }
+
+  /**
+   * \brief Calculate f of x with the scratch memory in workspace.
+   * \details It doesn't modify this object, so threads can share it if each thread has its own
+   * workspace made by make_workspace().
+   */
+  R operator()(const typename polynomial_type::coord_type& x, Workspace& workspace) const {
+    const auto terms = polynomial_.cbegin();
+    return Evaluate([terms](std::size_t k) { return terms[k].second; }, x, workspace);
+  }
+
+  /**
+   * \brief Make a workspace of the const evaluation, which is allocated by the allocator of the
+   * polynomial.
+   */
+  Workspace make_workspace() const {
+    const auto n_partitions = partition_.empty() ? 0 : partition_.size() - 1;
+    return Workspace{
+        coeff_vector_type(n_partitions, R(0), polynomial_.get_allocator()),
+        coeff_vector_type(n_partitions, R(0), polynomial_.get_allocator()),
+        projection_.make_workspace()
+    };
+  }
+
+  /**
+   * \brief Calculate the value and the gradient at x in one pass.
+   */
+  auto value_and_gradient(const typename polynomial_type::coord_type& x) {
+    return value_and_gradient(x, workspace_);
+  }
+
+  /**
+   * \brief Calculate the value and the gradient at x with the scratch memory in workspace.
+   */
+  auto value_and_gradient(
+      const typename polynomial_type::coord_type& x, Workspace& workspace
+  ) const {
+    const auto terms = polynomial_.cbegin();
+    return ValueAndGradient([terms](std::size_t k) { return terms[k].second; }, x, workspace);
+  }
+
+  template <class Derived>
+    requires(Derived::RowsAtCompileTime == dim && Derived::ColsAtCompileTime == Eigen::Dynamic)
+  auto operator()(const Eigen::ArrayBase<Derived>& xs) const {
+    return Of(polynomial_, xs);
   }
 
   const auto& get_polynomial() const { return polynomial_; }
@@ -1076,29 +1891,91 @@ class ExactOf<IntType, R, 2, AllocatorOrContainer> {
     polynomial_ = std::move(p);
 
     // Make a partition from polynomial_.
-    std::array<partition_type, dim - 1> partitions;
+    const auto allocator  = polynomial_.get_allocator();
+    auto       partitions = MakeArray<partition_type, dim - 1>(allocator);
     MakePartitions(polynomial_, partitions);
-    partition_ = partitions.back();
+    // Keep the positions of the partitions, which stay valid when this object is copied.
+    partition_ = position_vector_type(allocator);
+    partition_.reserve(partitions.back().size());
+    for (const auto& polynomial_const_it : partitions.back()) {
+      partition_.push_back(std::distance(polynomial_.cbegin(), polynomial_const_it));
+    }
 
-    // Make a projected polynomial.
-    auto projected_polynomial = projected_polynomial_type();
-    projected_polynomial.clear();
+    // Make a projected polynomial. The indexes are parts of the valid ones in order.
+    auto projected_seq = typename projected_polynomial_type::sequence_type(allocator);
+    projected_seq.reserve(partition_.size() - 1);
     for (const auto& polynomial_const_it :
-         std::ranges::subrange(partition_.begin(), std::prev(partition_.end()))) {
-      projected_polynomial.emplace_hint(
-          projected_polynomial.end(),
-          polynomial_const_it->first[0],
-          polynomial_const_it->second
-      );
+         std::ranges::subrange(partitions.back().begin(), std::prev(partitions.back().end()))) {
+      projected_seq.emplace_back(polynomial_const_it->first[0], polynomial_const_it->second);
     }
+    auto projected_polynomial =
+        projected_polynomial_type(projected_polynomial_alloc_type(allocator));
+    projected_polynomial.adopt_sequence(ordered_unique_valid_range, std::move(projected_seq));
     projection_.set_polynomial(std::move(projected_polynomial));
+
+    workspace_ = make_workspace();
   }
 
   void set_polynomial(const polynomial_type& p) { set_polynomial(polynomial_type(p)); }
 
+  /**
+   * \brief Replace the coefficients in order of the terms.
+   * \details The indexes and the partitions are kept, so it is a copy of the coefficients.
+   */
+  void set_coefficients(std::span<const R> coeffs) {
+    CheckCoefficientSize(polynomial_.size(), coeffs.size());
+    auto coeff_it = coeffs.begin();
+    for (auto& index_and_value : polynomial_) {
+      index_and_value.second = *coeff_it++;
+    }
+  }
+
   auto move_polynomial() { return std::move(polynomial_); }
 
  private:
+  template <std::signed_integral, class, int, class>
+  friend class ExactOf;
+
+  /**
+   * \brief Calculate f of x whose k-th coefficient is coeff(k).
+   */
+  template <class Coeff>
+  R Evaluate(
+      Coeff coeff, const typename polynomial_type::coord_type& x, Workspace& workspace
+  ) const {
+    for (std::size_t k = 0; k + 1 < partition_.size(); ++k) {
+      workspace.coeffs[k] = Calculate(partition_[k], partition_[k + 1], coeff, x);
+    }
+    const auto& coeffs = workspace.coeffs;
+    return projection_.Evaluate(
+        [&coeffs](std::size_t k) { return coeffs[k]; }, x[0], workspace.projection
+    );
+  }
+
+  /**
+   * \brief Calculate the value and the gradient at x of f whose k-th coefficient is coeff(k).
+   */
+  template <class Coeff>
+  auto ValueAndGradient(
+      Coeff coeff, const typename polynomial_type::coord_type& x, Workspace& workspace
+  ) const {
+    for (std::size_t k = 0; k + 1 < partition_.size(); ++k) {
+      const auto [value, derivative] =
+          CalculateWithDerivative(partition_[k], partition_[k + 1], coeff, x);
+      workspace.coeffs[k]      = value;
+      workspace.derivatives[k] = derivative;
+    }
+    const auto& coeffs               = workspace.coeffs;
+    const auto& derivatives          = workspace.derivatives;
+    const auto [value, derivative_0] = projection_.ValueAndGradient(
+        [&coeffs](std::size_t k) { return coeffs[k]; }, x[0], workspace.projection
+    );
+    const auto derivative_1 = projection_.Evaluate(
+        [&derivatives](std::size_t k) { return derivatives[k]; }, x[0], workspace.projection
+    );
+    return std::make_pair(value, typename polynomial_type::coord_type(derivative_0, derivative_1));
+  }
+
   void MakePartitions(
       const polynomial_type& polynomial, std::array<partition_type, dim - 1>& partitions
   ) {
@@ -1137,28 +2014,61 @@ class ExactOf<IntType, R, 2, AllocatorOrContainer> {
     }
   }
 
-  template <class Iterator>
-  auto Calculate(
-      Iterator cbegin, Iterator cend, int axis, const typename polynomial_type::coord_type& x
+  /**
+   * \brief Calculate the coefficient of the projection from the terms in [first, last) by
+   * Horner's method along the last axis.
+   */
+  template <class Coeff>
+  R Calculate(
+      std::size_t                                 first,
+      std::size_t                                 last,
+      Coeff                                       coeff,
+      const typename polynomial_type::coord_type& x
   ) const {
-    auto [last_index, last_coeff] = *cbegin;
-    std::for_each(
-        std::next(cbegin),
-        cend,
-        [&last_coeff, &last_index, &x, axis](const typename polynomial_type::value_type& i_and_c) {
-          const auto& [next_index, next_coeff] = i_and_c;
-          last_coeff *= std::pow(x[axis], last_index[axis] - next_index[axis]);
-          last_coeff += next_coeff;
-          last_index = next_index;
-        }
-    );
-    last_coeff *= std::pow(x[axis], last_index[axis]);
+    constexpr int axis       = dim - 1;
+    const auto    terms      = polynomial_.cbegin();
+    auto          last_index = terms[first].first[axis];
+    auto          last_coeff = coeff(first);
+    for (auto k = first + 1; k != last; ++k) {
+      const auto next_index = terms[k].first[axis];
+      last_coeff *= Pow(x[axis], last_index - next_index);
+      last_coeff += coeff(k);
+      last_index = next_index;
+    }
+    last_coeff *= Pow(x[axis], last_index);
     return last_coeff;
   }
 
-  polynomial_type                                         polynomial_;
-  partition_type                                          partition_;
-  ExactOf<IntType, R, 1, projected_polynomial_alloc_type> projection_;
+  /**
+   * \brief Calculate the same as Calculate and its derivative along the last axis.
+   */
+  template <class Coeff>
+  std::pair<R, R> CalculateWithDerivative(
+      std::size_t                                 first,
+      std::size_t                                 last,
+      Coeff                                       coeff,
+      const typename polynomial_type::coord_type& x
+  ) const {
+    constexpr int axis            = dim - 1;
+    const auto    terms           = polynomial_.cbegin();
+    auto          last_index      = terms[first].first[axis];
+    auto          last_coeff      = coeff(first);
+    auto          last_derivative = R(0);
+    for (auto k = first + 1; k != last; ++k) {
+      const auto next_index = terms[k].first[axis];
+      HornerStep(last_coeff, last_derivative, x[axis], last_index - next_index);
+      last_coeff += coeff(k);
+      last_index = next_index;
+    }
+    HornerStep(last_coeff, last_derivative, x[axis], last_index);
+    return std::make_pair(last_coeff, last_derivative);
+  }
+
+  polynomial_type      polynomial_;
+  position_vector_type partition_;
+  projection_type      projection_;
+  // The workspace of the non-const evaluation.
+  Workspace workspace_;
 };
 
 template <std::signed_integral IntType, class R, class AllocatorOrContainer>
@@ -1169,6 +2079,11 @@ class ExactOf<IntType, R, 1, AllocatorOrContainer> {
   using alloc_traits    = std::allocator_traits<AllocatorOrContainer>;
   using polynomial_type = Polynomial<IntType, R, IndexComparer<IntType, dim>, AllocatorOrContainer>;
 
+  /**
+   * \brief The const evaluation of one variable needs no scratch memory.
+   */
+  struct Workspace {};
+
   explicit ExactOf(polynomial_type&& p) { set_polynomial(std::move(p)); }
 
   explicit ExactOf(const polynomial_type& p) : ExactOf(polynomial_type(p)) {}
@@ -1181,21 +2096,34 @@ class ExactOf<IntType, R, 1, AllocatorOrContainer> {
   virtual ~ExactOf()                       = default;
 
   auto operator()(typename polynomial_type::coord_type x) const {
-    auto cbegin                   = polynomial_.cbegin();
-    auto cend                     = polynomial_.cend();
-    auto [last_index, last_coeff] = *cbegin;
-    std::for_each(
-        std::next(cbegin),
-        cend,
-        [&last_coeff, &last_index, x](const typename polynomial_type::value_type& i_and_c) {
-          const auto& [next_index, next_coeff] = i_and_c;
-          last_coeff *= std::pow(x, last_index - next_index);
-          last_coeff += next_coeff;
-          last_index = next_index;
-        }
-    );
-    last_coeff *= std::pow(x, last_index);
-    return last_coeff;
+    auto workspace = Workspace();
+    return (*this)(x, workspace);
+  }
+
+  R operator()(typename polynomial_type::coord_type x, Workspace& workspace) const {
+    const auto terms = polynomial_.cbegin();
+    return Evaluate([terms](std::size_t k) { return terms[k].second; }, x, workspace);
+  }
+
+  Workspace make_workspace() const { return Workspace(); }
+
+  /**
+   * \brief Calculate the value and the derivative at x by Horner's method.
+   */
+  auto value_and_gradient(typename polynomial_type::coord_type x) const {
+    auto workspace = Workspace();
+    return value_and_gradient(x, workspace);
+  }
+
+  auto value_and_gradient(typename polynomial_type::coord_type x, Workspace& workspace) const {
+    const auto terms = polynomial_.cbegin();
+    return ValueAndGradient([terms](std::size_t k) { return terms[k].second; }, x, workspace);
+  }
+
+  template <class Derived>
+    requires(Derived::RowsAtCompileTime == dim && Derived::ColsAtCompileTime == Eigen::Dynamic)
+  auto operator()(const Eigen::ArrayBase<Derived>& xs) const {
+    return Of(polynomial_, xs);
   }
 
   const auto& get_polynomial() const { return polynomial_; }
@@ -1206,9 +2134,63 @@ class ExactOf<IntType, R, 1, AllocatorOrContainer> {
 
   void set_polynomial(const polynomial_type& p) { set_polynomial(polynomial_type(p)); }
 
+  /**
+   * \brief Replace the coefficients in order of the terms.
+   * \details The indexes and the partitions are kept, so it is a copy of the coefficients.
+   */
+  void set_coefficients(std::span<const R> coeffs) {
+    CheckCoefficientSize(polynomial_.size(), coeffs.size());
+    auto coeff_it = coeffs.begin();
+    for (auto& index_and_value : polynomial_) {
+      index_and_value.second = *coeff_it++;
+    }
+  }
+
   auto move_polynomial() { return std::move(polynomial_); }
 
  private:
+  template <std::signed_integral, class, int, class>
+  friend class ExactOf;
+
+  /**
+   * \brief Calculate f of x whose k-th coefficient is coeff(k) by Horner's method.
+   */
+  template <class Coeff>
+  R Evaluate(Coeff coeff, typename polynomial_type::coord_type x, Workspace&) const {
+    const auto terms      = polynomial_.cbegin();
+    auto       last_index = terms[0].first;
+    auto       last_coeff = coeff(0);
+    for (std::size_t k = 1; k != polynomial_.size(); ++k) {
+      const auto next_index = terms[k].first;
+      last_coeff *= Pow(x, last_index - next_index);
+      last_coeff += coeff(k);
+      last_index = next_index;
+    }
+    last_coeff *= Pow(x, last_index);
+    return last_coeff;
+  }
+
+  /**
+   * \brief Calculate the value and the derivative at x of f whose k-th coefficient is coeff(k).
+   */
+  template <class Coeff>
+  std::pair<R, R> ValueAndGradient(
+      Coeff coeff, typename polynomial_type::coord_type x, Workspace&
+  ) const {
+    const auto terms           = polynomial_.cbegin();
+    auto       last_index      = terms[0].first;
+    auto       last_coeff      = coeff(0);
+    auto       last_derivative = R(0);
+    for (std::size_t k = 1; k != polynomial_.size(); ++k) {
+      const auto next_index = terms[k].first;
+      HornerStep(last_coeff, last_derivative, x, last_index - next_index);
+      last_coeff += coeff(k);
+      last_index = next_index;
+    }
+    HornerStep(last_coeff, last_derivative, x, last_index);
+    return std::make_pair(last_coeff, last_derivative);
+  }
+
   polynomial_type polynomial_;
 };
 }  // namespace mvPolynomial
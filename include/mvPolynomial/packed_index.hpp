@@ -0,0 +1,142 @@
+#ifndef _MVPOLYNOMIAL_PACKED_INDEX_HPP_
+#define _MVPOLYNOMIAL_PACKED_INDEX_HPP_
+
+#include "mvPolynomial/type.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+namespace mvPolynomial {
+/**
+ * \brief A class packing an index into a single unsigned integer.
+ * \details Each element of an index takes Bits bits and the highest bit of each field is a guard
+ * bit, which is always zero in a valid packed index. The 0th element is in the highest field, so
+ * comparing two packed indexes as integers gives the same order as IndexComparer, and adding them
+ * gives the packed sum of the indexes. If an element of the sum exceeds max_element, its guard bit
+ * is set, so the overflow is detected by one mask.
+ * \tparam IntType the type of elements of indices.
+ * \tparam D the dimension of indices.
+ * \tparam Word an unsigned integer type which holds a packed index (std::uint64_t or unsigned
+ * __int128).
+ * \tparam Bits the number of bits of each element including a guard bit. By default, the word is
+ * split evenly, but an element never takes more bits than IntType has plus a guard bit.
+ */
+template <
+    std::signed_integral IntType,
+    int D,
+    class Word = std::uint64_t,
+    int Bits   = std::min(
+        static_cast<int>(sizeof(Word) * CHAR_BIT) / D, std::numeric_limits<IntType>::digits + 1
+    )>
+class PackedIndex {
+ public:
+  static_assert(D > 0, "PackedIndex: the dimension must be positive.");
+  static_assert(Word(0) < Word(-1), "PackedIndex: the word must be unsigned.");
+  static_assert(
+      Bits >= 2 && Bits * D <= static_cast<int>(sizeof(Word) * CHAR_BIT),
+      "PackedIndex: each element needs at least 2 bits and all of them must fit in the word."
+  );
+  // Otherwise, an element could exceed max_element without setting its guard bit.
+  static_assert(
+      Bits <= std::numeric_limits<IntType>::digits + 1,
+      "PackedIndex: each element must not have more bits than IntType plus a guard bit."
+  );
+
+  static constexpr int dim  = D;
+  static constexpr int bits = Bits;
+
+  using index_type = IndexType<IntType, dim>;
+  using word_type  = Word;
+
+  static constexpr IntType max_element = static_cast<IntType>(std::min<word_type>(
+      (word_type(1) << (bits - 1)) - 1, static_cast<word_type>(std::numeric_limits<IntType>::max())
+  ));
+
+ private:
+  static constexpr int word_bits = static_cast<int>(sizeof(word_type) * CHAR_BIT);
+
+  // Shifting by word_bits is undefined, so a field of the whole word (D == 1) is shifted less.
+  static constexpr word_type field_mask = ~word_type(0) >> (word_bits - bits);
+
+  static constexpr word_type MakeGuardMask() noexcept {
+    auto mask = word_type(0);
+    for (auto i = 0; i != dim; ++i) {
+      mask |= word_type(1) << (i * bits + bits - 1);
+    }
+    return mask;
+  }
+
+  /**
+   * \brief Return the shift of the field of the ith element.
+   */
+  static constexpr int Shift(int i) noexcept { return (dim - 1 - i) * bits; }
+
+ public:
+  static constexpr word_type guard_mask = MakeGuardMask();
+
+  /**
+   * \brief Return true if each element of the index is in [0, max_element].
+   */
+  static bool CanPack(const index_type& index) noexcept {
+    return (index >= 0).all() && (index <= max_element).all();
+  }
+
+  /**
+   * \brief Pack an index. The index must satisfy CanPack.
+   */
+  static word_type Pack(const index_type& index) noexcept {
+    auto word = word_type(0);
+    for (auto i = 0; i != dim; ++i) {
+      word |= static_cast<word_type>(index[i]) << Shift(i);
+    }
+    return word;
+  }
+
+  static index_type Unpack(word_type word) noexcept {
+    auto index = index_type();
+    for (auto i = 0; i != dim; ++i) {
+      index[i] = static_cast<IntType>((word >> Shift(i)) & field_mask);
+    }
+    return index;
+  }
+
+  /**
+   * \brief Return true if any element of a sum of packed indexes exceeds max_element.
+   */
+  static constexpr bool Overflows(word_type sum) noexcept { return (sum & guard_mask) != 0; }
+
+  /**
+   * \brief Add two packed indexes, which is the packed index of a product of two monomials.
+   * \return the sum, or std::nullopt if any element overflows.
+   */
+  static constexpr std::optional<word_type> Add(word_type l, word_type r) noexcept {
+    auto sum = l + r;
+    if (Overflows(sum)) {
+      return std::nullopt;
+    }
+    return sum;
+  }
+};
+
+/**
+ * \brief The PackedIndex with the smallest word which gives each element at least 4 bits.
+ */
+template <std::signed_integral IntType, int D>
+using DefaultPackedIndex = std::conditional_t<
+    (D <= 16),
+    PackedIndex<IntType, D>,
+    PackedIndex<IntType, D, unsigned __int128>>;
+
+/**
+ * \brief Whether indexes of the dimension can be packed by DefaultPackedIndex.
+ */
+template <int D>
+inline constexpr bool is_packable_dim = (D <= 32);
+}  // namespace mvPolynomial
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef _MVPOLYNOMIAL_PMR_HPP_
+#define _MVPOLYNOMIAL_PMR_HPP_
+
+#include "mvPolynomial/type.hpp"
+#include "mvPolynomial/index_comparer.hpp"
+#include "mvPolynomial/mvPolynomial.hpp"
+#include "mvPolynomial/polynomial.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+
+namespace mvPolynomial::pmr {
+/**
+ * \brief MVPolynomial which allocates from a std::pmr::memory_resource.
+ * \details The temporaries of the operators and the functions (ex. the products of operator*, the
+ * heap of Sum and the partitions of ExactOf) are allocated from the same memory resource.
+ */
+template <
+    std::signed_integral IntType,
+    std::floating_point  R,
+    int                  D,
+    class Comparer = IndexComparer<IntType, D>>
+using MVPolynomial = mvPolynomial::MVPolynomial<
+    IntType,
+    R,
+    D,
+    Comparer,
+    std::pmr::polymorphic_allocator<std::pair<IndexType<IntType, D>, R>>>;
+
+template <std::signed_integral IntType, std::floating_point R, int D>
+using DefaultMVPolynomial = MVPolynomial<IntType, R, D>;
+
+template <
+    std::signed_integral IntType,
+    std::floating_point  R,
+    class Comparer = IndexComparer<IntType, 1>>
+using Polynomial = mvPolynomial::
+    Polynomial<IntType, R, Comparer, std::pmr::polymorphic_allocator<std::pair<IntType, R>>>;
+
+template <std::signed_integral IntType, std::floating_point R>
+using DefaultPolynomial = Polynomial<IntType, R>;
+
+template <std::signed_integral IntType, std::floating_point R, int D>
+using ExactOf = mvPolynomial::
+    ExactOf<IntType, R, D, std::pmr::polymorphic_allocator<std::pair<IndexType<IntType, D>, R>>>;
+
+/**
+ * \brief A scoped monotonic arena which is the default memory resource while it lives.
+ * \details The pmr polynomials which are made in the scope and their temporaries allocate from the
+ * arena, and all of the memory is released at once when the arena is destroyed, so the polynomials
+ * must not outlive it. The default memory resource is shared by all threads, so arenas must be
+ * nested like scopes and the other threads must not use the default memory resource meanwhile.
+ */
+class Arena {
+ public:
+  /**
+   * \param[in] upstream the memory resource which the arena gets its blocks from.
+   */
+  explicit Arena(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+      : resource_(upstream), previous_(std::pmr::set_default_resource(&resource_)) {}
+
+  /**
+   * \param[in] initial_size the size of the first block which is allocated from upstream.
+   * \param[in] upstream the memory resource which the arena gets its blocks from.
+   */
+  explicit Arena(
+      std::size_t                initial_size,
+      std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+  )
+      : resource_(initial_size, upstream),
+        previous_(std::pmr::set_default_resource(&resource_)) {}
+
+  /**
+   * \brief Use a buffer as the first block, which makes no allocation from upstream until the
+   * buffer is exhausted.
+   * \param[in] upstream the memory resource which the arena gets its blocks from.
+   * std::pmr::null_memory_resource() makes the arena throw std::bad_alloc instead.
+   */
+  explicit Arena(
+      void*                      buffer,
+      std::size_t                size,
+      std::pmr::memory_resource* upstream = std::pmr::get_default_resource()
+  )
+      : resource_(buffer, size, upstream), previous_(std::pmr::set_default_resource(&resource_)) {}
+
+  Arena(const Arena& other)            = delete;
+  Arena& operator=(const Arena& other) = delete;
+  Arena(Arena&& other)                 = delete;
+  Arena& operator=(Arena&& other)      = delete;
+
+  ~Arena() { std::pmr::set_default_resource(previous_); }
+
+  std::pmr::memory_resource* resource() noexcept { return &resource_; }
+
+  /**
+   * \brief Return an allocator which allocates from the arena.
+   */
+  template <class T = std::byte>
+  std::pmr::polymorphic_allocator<T> get_allocator() noexcept {
+    return std::pmr::polymorphic_allocator<T>(&resource_);
+  }
+
+ private:
+  std::pmr::monotonic_buffer_resource resource_;
+  std::pmr::memory_resource*          previous_;
+};
+}  // namespace mvPolynomial::pmr
+
+#endif
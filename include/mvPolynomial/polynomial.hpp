@@ -3,19 +3,26 @@
 
 #include "mvPolynomial/type.hpp"
 #include "mvPolynomial/index_comparer.hpp"
+#include "mvPolynomial/multiplication.hpp"
+#include "mvPolynomial/pow.hpp"
+#include "mvPolynomial/validation.hpp"
 
+#include <algorithm>
 #include <concepts>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 #include "boost/container/flat_map.hpp"
-#include "boost/container/new_allocator.hpp"
 #include "fmt/core.h"
 
 namespace mvPolynomial {
 template <
     std::signed_integral IntType,
     class R,
-    class Comparer             = IndexComparer<IntType, 1>,
-    class AllocatorOrContainer = boost::container::new_allocator<std::pair<IntType, R>>>
+    class Comparer              = IndexComparer<IntType, 1>,
+    class AllocatorOrContainer  = std::allocator<std::pair<IntType, R>>,
+    ValidationPolicy Validation = ValidateIndexes>
 class Polynomial {
  public:
   inline static const int dim{1};
@@ -128,6 +135,26 @@ class Polynomial {
     CheckSelfIndexes();
   }
 
+  template <typename InputIterator>
+  explicit Polynomial(ordered_unique_valid_range_t o, InputIterator s, InputIterator e)
+      : index2value_(o, s, e) {}
+
+  template <typename InputIterator>
+  explicit Polynomial(
+      ordered_unique_valid_range_t o, InputIterator s, InputIterator e, const Comparer& c
+  )
+      : index2value_(o, s, e, c) {}
+
+  template <typename InputIterator>
+  explicit Polynomial(
+      ordered_unique_valid_range_t o,
+      InputIterator                s,
+      InputIterator                e,
+      const Comparer&              c,
+      const allocator_type&        a
+  )
+      : index2value_(o, s, e, c, a) {}
+
   explicit Polynomial(std::initializer_list<value_type> l) : index2value_(l) { CheckSelfIndexes(); }
 
   explicit Polynomial(std::initializer_list<value_type> l, const allocator_type& a)
@@ -173,14 +200,10 @@ class Polynomial {
   }
 
   explicit Polynomial(const Polynomial& m, const allocator_type& a)
-      : index2value_(m.index2value_, a) {
-    CheckSelfIndexes();
-  }
+      : index2value_(m.index2value_, a) {}
 
   explicit Polynomial(Polynomial&& m, const allocator_type& a)
-      : index2value_(std::move(m.index2value_), a) {
-    CheckSelfIndexes();
-  }
+      : index2value_(std::move(m.index2value_), a) {}
 
   Polynomial& operator=(std::initializer_list<value_type> l) {
     index2value_ = l;
@@ -441,14 +464,30 @@ class Polynomial {
     return index2value_.equal_range(i);
   }
 
-  sequence_type extract_sequence() { return index2value_.extract_sequence(); }
+  sequence_type extract_sequence() {
+    detail::SequenceFence();
+    return index2value_.extract_sequence();
+  }
 
-  void adopt_sequence(sequence_type&& seq) { index2value_.adopt_sequence(std::move(seq)); }
+  void adopt_sequence(sequence_type&& seq) {
+    detail::SequenceFence();
+    index2value_.adopt_sequence(std::move(seq));
+    CheckSelfIndexes();
+  }
   void adopt_sequence(boost::container::ordered_unique_range_t o, sequence_type&& seq) {
+    detail::SequenceFence();
+    index2value_.adopt_sequence(o, std::move(seq));
+    CheckSelfIndexes();
+  }
+  void adopt_sequence(ordered_unique_valid_range_t o, sequence_type&& seq) {
+    detail::SequenceFence();
     index2value_.adopt_sequence(o, std::move(seq));
   }
 
-  const sequence_type& sequence() const noexcept { return index2value_.sequence(); }
+  const sequence_type& sequence() const noexcept {
+    detail::SequenceFence();
+    return index2value_.sequence();
+  }
 
   reference       front() { return *(index2value_.begin()); }
   const_reference front() const { return *(index2value_.cbegin()); }
@@ -475,6 +514,34 @@ class Polynomial {
     return *this;
   }
 
+  /**
+   * \brief Add r in place by merging it backward into the sequence of this polynomial.
+   * \details The sequence is only resized, so it doesn't allocate if its capacity suffices.
+   */
+  Polynomial& operator+=(const Polynomial& r) {
+    if (this == &r) {
+      return *this *= mapped_type(2);
+    }
+    MergeAssign(r, mapped_type(1));
+    return *this;
+  }
+
+  /**
+   * \brief Subtract r in place by merging it backward into the sequence of this polynomial.
+   */
+  Polynomial& operator-=(const Polynomial& r) {
+    if (this == &r) {
+      return *this *= mapped_type(0);
+    }
+    MergeAssign(r, mapped_type(-1));
+    return *this;
+  }
+
+  Polynomial& operator*=(const Polynomial& r) {
+    *this = *this * r;
+    return *this;
+  }
+
   // friend functions
   // TODO consider tolerance.
   friend bool operator==(const Polynomial& l, const Polynomial& r) {
@@ -557,49 +624,112 @@ class Polynomial {
 
   friend Polynomial operator*(const Polynomial& l, const Polynomial& r) {
     auto comparer = l.key_comp();
-    auto mul      = std::vector<value_type>();
-    mul.reserve(l.size() * r.size());
-    // Calculate all product of each l's term and r's term.
-    for (const auto& l_p : l) {
-      const auto& [l_idx, l_v] = l_p;
-      for (const auto& r_p : r) {
-        const auto& [r_idx, r_v] = r_p;
-        mul.emplace_back(l_idx + r_idx, l_v * r_v);
+    auto seq      = sequence_type(l.get_allocator());
+    if constexpr (std::is_same_v<Comparer, IndexComparer<IntType, 1>>) {
+      // IndexComparer keeps the order of indexes when they are added to the same index.
+      const auto& small_p = l.size() <= r.size() ? l : r;
+      const auto& large_p = l.size() <= r.size() ? r : l;
+      const auto  small   = small_p.begin();
+      const auto  large   = large_p.begin();
+      HeapMultiply(
+          small_p.size(),
+          large_p.size(),
+          [small, large](std::size_t i, std::size_t j) {
+            return std::pair<index_type, R>(
+                small[i].first + large[j].first, small[i].second * large[j].second
+            );
+          },
+          comparer,
+          [&seq](index_type index, R value) { seq.emplace_back(index, value); },
+          l.get_allocator()
+      );
+    } else {
+      using value_allocator =
+          typename std::allocator_traits<allocator_type>::template rebind_alloc<value_type>;
+      auto mul = std::vector<value_type, value_allocator>(l.get_allocator());
+      mul.reserve(l.size() * r.size());
+      // Calculate all product of each l's term and r's term.
+      for (const auto& l_p : l) {
+        const auto& [l_idx, l_v] = l_p;
+        for (const auto& r_p : r) {
+          const auto& [r_idx, r_v] = r_p;
+          mul.emplace_back(l_idx + r_idx, l_v * r_v);
+        }
+      }
+      std::sort(mul.begin(), mul.end(), [&comparer](const value_type& l, const value_type& r) {
+        return comparer(l.first, r.first);
+      });
+      // Combine the products which have the same index.
+      seq.reserve(mul.size());
+      for (const auto& [index, value] : mul) {
+        if (!seq.empty() && seq.back().first == index) {
+          seq.back().second += value;
+        } else {
+          seq.emplace_back(index, value);
+        }
       }
     }
-    std::sort(mul.begin(), mul.end(), [&comparer](const value_type& l, const value_type& r) {
-      return comparer(l.first, r.first);
-    });
-    auto rm_begin =
-        std::unique(mul.begin(), mul.end(), [](const value_type& l, const value_type& r) {
-          return (l.first == r.first).all();
-        });
-    // For simplicity, I make a Polynomial now.
-    auto mp = Polynomial(
-        boost::container::ordered_unique_range_t(),
-        mul.begin(),
-        rm_begin,
-        comparer,
-        l.get_allocator()
-    );
-    // Add duplicated elements to mp.
-    for (auto it = rm_begin; it != mul.end(); ++it) {
-      mp[it->first] += it->second;
-    }
-
-    return mp;
+    auto p = Polynomial(comparer, l.get_allocator());
+    p.adopt_sequence(ordered_unique_valid_range, std::move(seq));
+    return p;
   }
 
   friend void swap(Polynomial& l, Polynomial& r) { swap(l.index2value_, r.index2value_); }
 
  private:
+  /**
+   * \brief Merge sign * r into this polynomial from the last terms.
+   */
+  void MergeAssign(const Polynomial& r, mapped_type sign) {
+    const auto comparer = key_comp();
+    auto       seq      = extract_sequence();
+
+    // Count the terms of r which this polynomial doesn't have.
+    auto n_new = size_type(0);
+    auto l_it  = seq.cbegin();
+    for (const auto& r_p : r) {
+      while (l_it != seq.cend() && comparer(l_it->first, r_p.first)) {
+        ++l_it;
+      }
+      if (l_it == seq.cend() || comparer(r_p.first, l_it->first)) {
+        ++n_new;
+      }
+    }
+
+    auto i = seq.size();
+    seq.resize(seq.size() + n_new);
+    auto k = seq.size();
+    auto j = r.size();
+    // Move the last of the rest terms to the back until all terms of r are merged.
+    while (j != 0) {
+      const auto& [r_idx, r_v] = *(r.begin() + (j - 1));
+      if (i != 0 && comparer(r_idx, seq[i - 1].first)) {
+        seq[--k] = std::move(seq[--i]);
+      } else if (i != 0 && !comparer(seq[i - 1].first, r_idx)) {
+        --i;
+        seq[--k] = value_type(std::move(seq[i].first), seq[i].second + sign * r_v);
+        --j;
+      } else {
+        seq[--k] = value_type(r_idx, sign * r_v);
+        --j;
+      }
+    }
+    adopt_sequence(ordered_unique_valid_range, std::move(seq));
+  }
+
   void CheckIndex(key_type index) const {
+    if constexpr (!Validation::validates) {
+      return;
+    }
     if (index < 0) {
       throw std::runtime_error(fmt::format("The index ({}) must be non-negative.", index));
     }
   }
 
   void CheckSelfIndexes() const {
+    if constexpr (!Validation::validates) {
+      return;
+    }
     for (const auto& index_and_value : index2value_) {
       const auto& [index, value] = index_and_value;
       CheckIndex(index);
@@ -624,16 +754,19 @@ class Polynomial {
 template <
     std::signed_integral IntType,
     class R,
-    class AllocatorOrContainer = boost::container::new_allocator<std::pair<IntType, R>>>
-using DefaultPolynomial = Polynomial<IntType, R, IndexComparer<IntType, 1>, AllocatorOrContainer>;
+    class AllocatorOrContainer = std::allocator<std::pair<IntType, R>>,
+    class Validation           = ValidateIndexes>
+using DefaultPolynomial =
+    Polynomial<IntType, R, IndexComparer<IntType, 1>, AllocatorOrContainer, Validation>;
 
 template <
     std::signed_integral IntType,
     class R,
     class Comparer,
-    class AllocatorOrContainer = boost::container::new_allocator<std::pair<IntType, R>>>
-auto D(const Polynomial<IntType, R, Comparer, AllocatorOrContainer>& p) {
-  using MP = Polynomial<IntType, R, Comparer, AllocatorOrContainer>;
+    class AllocatorOrContainer = std::allocator<std::pair<IntType, R>>,
+    class Validation           = ValidateIndexes>
+auto D(const Polynomial<IntType, R, Comparer, AllocatorOrContainer, Validation>& p) {
+  using MP = Polynomial<IntType, R, Comparer, AllocatorOrContainer, Validation>;
 
   auto new_index2value_seq = typename MP::sequence_type(p.get_allocator());
   new_index2value_seq.reserve(p.size());
@@ -655,21 +788,18 @@ auto D(const Polynomial<IntType, R, Comparer, AllocatorOrContainer>& p) {
         return comparer(l.first, r.first);
       }
   );
-  return MP(
-      boost::container::ordered_unique_range_t(),
-      new_index2value_seq.begin(),
-      new_index2value_seq.end(),
-      comparer,
-      p.get_allocator()
-  );
+  auto d = MP(comparer, p.get_allocator());
+  d.adopt_sequence(ordered_unique_valid_range, std::move(new_index2value_seq));
+  return d;
 }
 
 template <
     std::signed_integral IntType,
     class R,
-    class AllocatorOrContainer = boost::container::new_allocator<std::pair<IntType, R>>>
-auto D(DefaultPolynomial<IntType, R, AllocatorOrContainer>&& p) {
-  using MP = DefaultPolynomial<IntType, R, AllocatorOrContainer>;
+    class AllocatorOrContainer = std::allocator<std::pair<IntType, R>>,
+    class Validation           = ValidateIndexes>
+auto D(DefaultPolynomial<IntType, R, AllocatorOrContainer, Validation>&& p) {
+  using MP = DefaultPolynomial<IntType, R, AllocatorOrContainer, Validation>;
 
   auto index2value_seq = p.extract_sequence();
   if (index2value_seq.back().first == 0) {
@@ -679,16 +809,17 @@ auto D(DefaultPolynomial<IntType, R, AllocatorOrContainer>&& p) {
     auto& [index, value] = index_and_value;
     value *= index--;
   }
-  p.adopt_sequence(boost::container::ordered_unique_range_t(), std::move(index2value_seq));
+  p.adopt_sequence(ordered_unique_valid_range, std::move(index2value_seq));
   return p;
 }
 
 template <
     class R,
     std::signed_integral IntType,
-    class AllocatorOrContainer = boost::container::new_allocator<std::pair<IntType, R>>>
-auto D(const DefaultPolynomial<IntType, R, AllocatorOrContainer>& p) {
-  using MP = DefaultPolynomial<IntType, R, AllocatorOrContainer>;
+    class AllocatorOrContainer = std::allocator<std::pair<IntType, R>>,
+    class Validation           = ValidateIndexes>
+auto D(const DefaultPolynomial<IntType, R, AllocatorOrContainer, Validation>& p) {
+  using MP = DefaultPolynomial<IntType, R, AllocatorOrContainer, Validation>;
   return D(MP(p));
 }
 
@@ -696,10 +827,10 @@ template <
     std::signed_integral IntType,
     class R,
     class Comparer = IndexComparer<IntType, 1>,
-    class AllocatorOrContainer =
-        boost::container::new_allocator<std::pair<IndexType<IntType, 1>, R>>>
-auto Integrate(Polynomial<IntType, R, Comparer, AllocatorOrContainer>&& p) {
-  using MP = Polynomial<IntType, R, Comparer, AllocatorOrContainer>;
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, 1>, R>>,
+    class Validation = ValidateIndexes>
+auto Integrate(Polynomial<IntType, R, Comparer, AllocatorOrContainer, Validation>&& p) {
+  using MP = Polynomial<IntType, R, Comparer, AllocatorOrContainer, Validation>;
 
   auto index2value = p.extract_sequence();
   for (auto& index_and_value : index2value) {
@@ -714,7 +845,7 @@ auto Integrate(Polynomial<IntType, R, Comparer, AllocatorOrContainer>&& p) {
         return comparer(l.first, r.first);
       }
   );
-  p.adopt_sequence(std::move(index2value));
+  p.adopt_sequence(ordered_unique_valid_range, std::move(index2value));
   return std::move(p);
 }
 
@@ -722,28 +853,29 @@ template <
     std::signed_integral IntType,
     class R,
     class Comparer = IndexComparer<IntType, 1>,
-    class AllocatorOrContainer =
-        boost::container::new_allocator<std::pair<IndexType<IntType, 1>, R>>>
-auto Integrate(const Polynomial<IntType, R, Comparer, AllocatorOrContainer>& p) {
-  return Integrate(Polynomial<IntType, R, Comparer, AllocatorOrContainer>(p));
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, 1>, R>>,
+    class Validation = ValidateIndexes>
+auto Integrate(const Polynomial<IntType, R, Comparer, AllocatorOrContainer, Validation>& p) {
+  return Integrate(Polynomial<IntType, R, Comparer, AllocatorOrContainer, Validation>(p));
 }
 
 template <
     std::signed_integral IntType,
     class R,
     class Comparer,
-    class AllocatorOrContainer =
-        boost::container::new_allocator<std::pair<IndexType<IntType, 1>, R>>>
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, 1>, R>>,
+    class Validation = ValidateIndexes>
 auto Of(
-    const Polynomial<IntType, R, Comparer, AllocatorOrContainer>&                      p,
-    const typename Polynomial<IntType, R, Comparer, AllocatorOrContainer>::coord_type& x
+    const Polynomial<IntType, R, Comparer, AllocatorOrContainer, Validation>& p,
+    const typename Polynomial<IntType, R, Comparer, AllocatorOrContainer, Validation>::
+        coord_type& x
 ) {
-  using MP = Polynomial<IntType, R, Comparer, AllocatorOrContainer>;
+  using MP = Polynomial<IntType, R, Comparer, AllocatorOrContainer, Validation>;
 
   typename MP::mapped_type sum = 0;
   for (const auto& index_and_value : p) {
     const auto& [index, value] = index_and_value;
-    sum += value * std::pow(x, index);
+    sum += value * Pow(x, index);
   }
   return sum;
 }
@@ -751,22 +883,80 @@ auto Of(
 template <
     std::signed_integral IntType,
     class R,
-    class AllocatorOrContainer =
-        boost::container::new_allocator<std::pair<IndexType<IntType, 1>, R>>>
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, 1>, R>>,
+    class Validation = ValidateIndexes>
 auto Of(
-    const DefaultPolynomial<IntType, R, AllocatorOrContainer>&                      p,
-    const typename DefaultPolynomial<IntType, R, AllocatorOrContainer>::coord_type& x
+    const DefaultPolynomial<IntType, R, AllocatorOrContainer, Validation>&                      p,
+    const typename DefaultPolynomial<IntType, R, AllocatorOrContainer, Validation>::coord_type& x
 ) {
   auto [last_index, last_coeff] = p.front();
   for (auto it = std::next(p.cbegin()); it != p.cend(); ++it) {
     const auto& [next_index, next_coeff] = *it;
-    last_coeff *= std::pow(x, last_index - next_index);
+    last_coeff *= Pow(x, last_index - next_index);
     last_coeff += next_coeff;
     last_index = next_index;
   }
-  last_coeff *= std::pow(x, last_index);
+  last_coeff *= Pow(x, last_index);
   return last_coeff;
 }
+
+template <
+    std::signed_integral IntType,
+    class R,
+    class Comparer,
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, 1>, R>>,
+    class Validation = ValidateIndexes,
+    class Derived>
+  requires(Derived::RowsAtCompileTime == 1)
+auto Of(
+    const Polynomial<IntType, R, Comparer, AllocatorOrContainer, Validation>& p,
+    const Eigen::ArrayBase<Derived>&                                          xs
+) {
+  using Values = Eigen::Array<R, 1, Derived::ColsAtCompileTime>;
+
+  Values values = Values::Zero(xs.cols());
+  for (const auto& index_and_value : p) {
+    const auto& [index, value] = index_and_value;
+    values += value * Pow(xs, index);
+  }
+  return values;
+}
+
+/**
+ * \brief Calculate f of each element of xs at once.
+ * \details If the number of columns of xs is fixed (ex. 4, 8 or 16), the calculation runs in SIMD
+ * registers without any allocation. The results are bit-identical to the scalar version, which is
+ * checked in debug build.
+ */
+template <
+    std::signed_integral IntType,
+    class R,
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, 1>, R>>,
+    class Validation = ValidateIndexes,
+    class Derived>
+  requires(Derived::RowsAtCompileTime == 1)
+auto Of(
+    const DefaultPolynomial<IntType, R, AllocatorOrContainer, Validation>& p,
+    const Eigen::ArrayBase<Derived>&                                       xs
+) {
+  using Values = Eigen::Array<R, 1, Derived::ColsAtCompileTime>;
+
+  // Run the same Horner's method as the scalar version on all points at once.
+  auto [last_index, last_coeff] = p.front();
+  Values values                 = Values::Constant(xs.cols(), last_coeff);
+  for (auto it = std::next(p.cbegin()); it != p.cend(); ++it) {
+    const auto& [next_index, next_coeff] = *it;
+    values     = values * Pow(xs, last_index - next_index) + next_coeff;
+    last_index = next_index;
+  }
+  values *= Pow(xs, last_index);
+#ifndef NDEBUG
+  for (Eigen::Index i = 0; i != xs.cols(); ++i) {
+    assert(values[i] == Of(p, R(xs(0, i))));
+  }
+#endif
+  return values;
+}
 }  // namespace mvPolynomial
 
 #endif
@@ -2,9 +2,23 @@
 #define _MVPOLYNOMIAL_POLYNOMIAL_PRODUCT_HPP_
 
 #include "mvPolynomial/type.hpp"
+#include "mvPolynomial/mvPolynomial.hpp"
+#include "mvPolynomial/pow.hpp"
+#include "mvPolynomial/validation.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <limits>
+#include <memory>
 #include <numeric>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 #include "boost/range/adaptor/indexed.hpp"
 #include "boost/tuple/tuple.hpp"
@@ -48,6 +62,9 @@ class PolynomialProduct {
 
   PolynomialProduct() { this->fill(MakeScalarPolynomial<polynomial_type>(1)); }
 
+  explicit PolynomialProduct(PolynomialContainer polynomials)
+      : polynomials_(std::move(polynomials)) {}
+
   template <typename InputIterator>
   PolynomialProduct(InputIterator s, InputIterator e) {
     if (std::distance(s, e) != polynomials_.size()) {
@@ -143,11 +160,17 @@ class PolynomialProduct {
   }
 
   friend PolynomialProduct operator*(const PolynomialProduct& l, const PolynomialProduct& r) {
-    auto mul = PolynomialProduct();
-    for (std::size_t i = 0; i != dim; ++i) {
-      mul[i] = l[i] * r[i];
-    }
-    return mul;
+    return Generate([&l, &r](std::size_t i) { return l[i] * r[i]; });
+  }
+
+  /**
+   * \brief Make a product whose i-th polynomial is f(i) without making any other polynomial.
+   */
+  template <class F>
+  static PolynomialProduct Generate(F f) {
+    return [&f]<std::size_t... I>(std::index_sequence<I...>) {
+      return PolynomialProduct(PolynomialContainer{f(I)...});
+    }(std::make_index_sequence<Dim>());
   }
 
  private:
@@ -159,26 +182,415 @@ auto Of(
     const PolynomialProduct<P, Dim>& pp, const typename PolynomialProduct<P, Dim>::coord_type& x
 ) {
   auto mul = typename PolynomialProduct<P, Dim>::polynomial_type::mapped_type(1);
-  for (const auto& index_and_pp : pp | boost::adaptors::indexed()) {
-    auto        index = index_and_pp.index();
-    const auto& p     = index_and_pp.value();
-    mul *= Of(p, x[index]);
+  for (std::size_t axis = 0; axis != Dim; ++axis) {
+    mul *= Of(pp[axis], x[axis]);
   }
   return mul;
 }
 
+/**
+ * \brief Calculate pp at all points of the grid made of the coordinates of each axis into out.
+ * \details Each polynomial is calculated only at the coordinates of its axis, and the values at
+ * the grid points are their outer product, which is written along the last axis by Eigen, so the
+ * work is a stream of writes. The values are in lexicographic order of the grid indexes (the last
+ * axis is contiguous) and bit-identical to Of at each point.
+ * \param[out] out a buffer whose size is the product of the numbers of the coordinates.
+ * \param[in] axis_coords the coordinates of each axis, which are contiguous ranges (ex.
+ * std::vector or Eigen::ArrayXd).
+ */
+template <class P, std::size_t Dim, class... Coords>
+  requires(sizeof...(Coords) == Dim)
+void OfOnGrid(
+    const PolynomialProduct<P, Dim>&   pp,
+    std::span<typename P::mapped_type> out,
+    const Coords&... axis_coords
+) {
+  using R      = typename P::mapped_type;
+  using Values = Eigen::Array<R, 1, Eigen::Dynamic>;
+  using Map    = Eigen::Map<const Values>;
+
+  const auto coords = std::array<std::span<const R>, Dim>{
+      std::span<const R>(std::data(axis_coords), static_cast<std::size_t>(std::size(axis_coords))
+      )...
+  };
+  auto n_points = std::size_t(1);
+  for (const auto& c : coords) {
+    n_points *= c.size();
+  }
+  if (out.size() != n_points) {
+    throw std::runtime_error(fmt::format(
+        "OfOnGrid: The size of the buffer is {}, but the grid has {} points.", out.size(), n_points
+    ));
+  }
+  if (n_points == 0) {
+    return;
+  }
+
+  auto values = std::array<Values, Dim>();
+  for (std::size_t axis = 0; axis != Dim; ++axis) {
+    const auto xs = Map(coords[axis].data(), static_cast<Eigen::Index>(coords[axis].size()));
+    if (pp[axis].empty()) {
+      values[axis] = Values::Zero(xs.cols());
+    } else {
+      values[axis] = Of(pp[axis], xs);
+    }
+  }
+
+  // prefix[k] is the product of the values of the axes from 0 to k at the current grid index,
+  // which is updated only from the axis whose index changes.
+  const auto& last    = values[Dim - 1];
+  auto        index   = std::array<Eigen::Index, Dim>();
+  auto        prefix  = std::array<R, Dim>();
+  auto        changed = std::size_t(0);
+  for (std::size_t offset = 0; offset != n_points; offset += coords[Dim - 1].size()) {
+    for (auto axis = changed; axis + 1 < Dim; ++axis) {
+      prefix[axis] = (axis == 0 ? R(1) : prefix[axis - 1]) * values[axis][index[axis]];
+    }
+    auto row = Eigen::Map<Values>(out.data() + offset, last.size());
+    if constexpr (Dim == 1) {
+      row = last;
+    } else {
+      row = prefix[Dim - 2] * last;
+    }
+    // Advance the grid index of the axes except the last one.
+    changed = 0;
+    for (auto axis = Dim - 1; axis-- != 0;) {
+      if (++index[axis] != values[axis].size()) {
+        changed = axis;
+        break;
+      }
+      index[axis] = 0;
+    }
+  }
+}
+
+/**
+ * \brief Calculate pp at all points of the grid made of the coordinates of each axis.
+ * \return the values in lexicographic order of the grid indexes.
+ */
+template <class P, std::size_t Dim, class... Coords>
+  requires(sizeof...(Coords) == Dim)
+auto OfOnGrid(const PolynomialProduct<P, Dim>& pp, const Coords&... axis_coords) {
+  auto n_points = Eigen::Index(1);
+  ((n_points *= static_cast<Eigen::Index>(std::size(axis_coords))), ...);
+  ValueArrayType<typename P::mapped_type> values(n_points);
+  OfOnGrid(
+      pp,
+      std::span<typename P::mapped_type>(values.data(), static_cast<std::size_t>(n_points)),
+      axis_coords...
+  );
+  return values;
+}
+
 template <class P, std::size_t Dim>
 auto D(const PolynomialProduct<P, Dim>& p, std::size_t axis) {
-  auto q     = PolynomialProduct<P, Dim>(p);
-  q.at(axis) = D(p.at(axis));
-  return q;
+  static_cast<void>(p.at(axis));  // Throw std::out_of_range for a wrong axis.
+  return PolynomialProduct<P, Dim>::Generate([&p, axis](std::size_t i) {
+    return i == axis ? D(p[i]) : p[i];
+  });
+}
+
+template <class P, std::size_t Dim>
+auto D(PolynomialProduct<P, Dim>&& p, std::size_t axis) {
+  auto& polynomial = p.at(axis);  // Throw std::out_of_range before reading a wrong axis.
+  polynomial       = D(std::move(polynomial));
+  return std::move(p);
 }
 
 template <class P, std::size_t Dim>
 auto Integrate(const PolynomialProduct<P, Dim>& p, std::size_t axis) {
-  auto q     = PolynomialProduct<P, Dim>(p);
-  q.at(axis) = Integrate(p.at(axis));
-  return q;
+  static_cast<void>(p.at(axis));  // Throw std::out_of_range for a wrong axis.
+  return PolynomialProduct<P, Dim>::Generate([&p, axis](std::size_t i) {
+    return i == axis ? Integrate(p[i]) : p[i];
+  });
+}
+
+template <class P, std::size_t Dim>
+auto Integrate(PolynomialProduct<P, Dim>&& p, std::size_t axis) {
+  auto& polynomial = p.at(axis);  // Throw std::out_of_range before reading a wrong axis.
+  polynomial       = Integrate(std::move(polynomial));
+  return std::move(p);
+}
+
+/**
+ * \brief A class calculating a product of polynomials from their terms flattened into arrays.
+ * \details The terms of all polynomials are stored in descending order of indexes in one array of
+ * coefficients and one array of the gaps between indexes, so each polynomial is calculated by
+ * Horner's method over contiguous memory without iterating maps. The values are bit-identical to
+ * Of of the product of DefaultPolynomial.
+ */
+template <class P, std::size_t Dim>
+class PolynomialProductOf {
+ public:
+  static constexpr std::size_t dim = Dim;
+
+  using product_type     = PolynomialProduct<P, Dim>;
+  using polynomial_type  = P;
+  using index_type       = typename polynomial_type::index_type;
+  using mapped_type      = typename polynomial_type::mapped_type;
+  using coord_type       = typename product_type::coord_type;
+  using coord_array_type = CoordArrayType<mapped_type, static_cast<int>(Dim)>;
+  using value_array_type = ValueArrayType<mapped_type>;
+  using allocator_type   = typename polynomial_type::allocator_type;
+
+  using coeff_vector_type = std::vector<
+      mapped_type,
+      typename std::allocator_traits<allocator_type>::template rebind_alloc<mapped_type>>;
+  using index_vector_type = std::vector<
+      index_type,
+      typename std::allocator_traits<allocator_type>::template rebind_alloc<index_type>>;
+
+  explicit PolynomialProductOf(const product_type& pp) { set_polynomial(pp); }
+
+  PolynomialProductOf()                                            = default;
+  PolynomialProductOf(const PolynomialProductOf& other)            = default;
+  PolynomialProductOf& operator=(const PolynomialProductOf& other) = default;
+  PolynomialProductOf(PolynomialProductOf&& other)                 = default;
+  PolynomialProductOf& operator=(PolynomialProductOf&& other)      = default;
+  virtual ~PolynomialProductOf()                                   = default;
+
+  mapped_type operator()(const coord_type& x) const {
+    auto mul = mapped_type(1);
+    for (std::size_t axis = 0; axis != dim; ++axis) {
+      mul *= Calculate(axis, x[axis]);
+    }
+    return mul;
+  }
+
+  /**
+   * \brief Calculate f of each column of xs.
+   * \details The points are sorted by each coordinate, so each polynomial is calculated once per
+   * unique coordinate of its axis (ex. once per line of a tensor grid).
+   */
+  value_array_type operator()(const coord_array_type& xs) const {
+    using Order = std::vector<
+        Eigen::Index,
+        typename std::allocator_traits<allocator_type>::template rebind_alloc<Eigen::Index>>;
+
+    const auto n_points = static_cast<std::size_t>(xs.cols());
+
+    value_array_type values = value_array_type::Ones(xs.cols());
+    auto             order  = Order(n_points, coeffs_.get_allocator());
+    for (std::size_t axis = 0; axis != dim; ++axis) {
+      const auto row = xs.row(axis);
+      std::iota(order.begin(), order.end(), Eigen::Index(0));
+      // strong_order is a total order even with NaN.
+      std::sort(order.begin(), order.end(), [&row](Eigen::Index l, Eigen::Index r) {
+        return std::strong_order(row[l], row[r]) < 0;
+      });
+      for (std::size_t begin = 0; begin != n_points;) {
+        const auto x     = row[order[begin]];
+        const auto value = Calculate(axis, x);
+        do {
+          values[order[begin++]] *= value;
+        } while (begin != n_points && std::strong_order(row[order[begin]], x) == 0);
+      }
+    }
+    return values;
+  }
+
+  void set_polynomial(const product_type& pp) {
+    const auto allocator = pp[0].get_allocator();
+
+    auto n_terms = std::size_t(0);
+    for (const auto& p : pp) {
+      n_terms += p.size();
+    }
+    coeffs_ = coeff_vector_type(allocator);
+    gaps_   = index_vector_type(allocator);
+    coeffs_.reserve(n_terms);
+    gaps_.reserve(n_terms);
+
+    using term_type = std::pair<index_type, mapped_type>;
+    using TermAllocator =
+        typename std::allocator_traits<allocator_type>::template rebind_alloc<term_type>;
+
+    auto terms = std::vector<term_type, TermAllocator>(allocator);
+    for (std::size_t axis = 0; axis != dim; ++axis) {
+      offsets_[axis] = coeffs_.size();
+      // Polynomials with any comparer are calculated from the greatest index.
+      terms.assign(pp[axis].begin(), pp[axis].end());
+      std::sort(terms.begin(), terms.end(), [](const auto& l, const auto& r) {
+        return l.first > r.first;
+      });
+      for (std::size_t k = 0; k != terms.size(); ++k) {
+        coeffs_.push_back(terms[k].second);
+        gaps_.push_back(k == 0 ? index_type(0) : terms[k - 1].first - terms[k].first);
+      }
+      lasts_[axis] = terms.empty() ? index_type(0) : terms.back().first;
+    }
+    offsets_[dim] = coeffs_.size();
+  }
+
+ private:
+  mapped_type Calculate(std::size_t axis, mapped_type x) const {
+    const auto begin = offsets_[axis];
+    const auto end   = offsets_[axis + 1];
+    if (begin == end) {
+      return mapped_type(0);
+    }
+    auto value = coeffs_[begin];
+    for (auto k = begin + 1; k != end; ++k) {
+      value *= Pow(x, gaps_[k]);
+      value += coeffs_[k];
+    }
+    value *= Pow(x, lasts_[axis]);
+    return value;
+  }
+
+  coeff_vector_type                coeffs_;
+  index_vector_type                gaps_;
+  std::array<std::size_t, Dim + 1> offsets_{};
+  std::array<index_type, Dim>      lasts_{};
+};
+
+/**
+ * \brief Expand pp into a multivariable polynomial.
+ * \details The terms of each polynomial are sorted in descending order of indexes once, and the
+ * products are emitted in the order of IndexComparer by counting the positions of the terms like an
+ * odometer, so the result is made in one sequence of the exact size without any sort.
+ */
+template <class P, std::size_t Dim>
+auto Expand(const PolynomialProduct<P, Dim>& pp) {
+  using IntType = typename P::index_type;
+  using R       = typename P::mapped_type;
+  using Alloc   = typename std::allocator_traits<typename P::allocator_type>::template rebind_alloc<
+      std::pair<IndexType<IntType, static_cast<int>(Dim)>, R>>;
+  using MP      = DefaultMVPolynomial<IntType, R, static_cast<int>(Dim), Alloc>;
+  using Terms   = std::vector<
+      std::pair<IntType, R>,
+      typename std::allocator_traits<Alloc>::template rebind_alloc<std::pair<IntType, R>>>;
+
+  const auto allocator = Alloc(pp[0].get_allocator());
+
+  auto terms   = MakeArray<Terms, Dim>(allocator);
+  auto n_terms = std::size_t(1);
+  for (std::size_t axis = 0; axis != Dim; ++axis) {
+    terms[axis].assign(pp[axis].begin(), pp[axis].end());
+    std::sort(terms[axis].begin(), terms[axis].end(), [](const auto& l, const auto& r) {
+      return l.first > r.first;
+    });
+    n_terms *= terms[axis].size();
+  }
+  if (n_terms == 0) {
+    // The same as a default-constructed polynomial, which has a zero constant term.
+    auto zero                    = MP(allocator);
+    zero[MP::index_type::Zero()] = R(0);
+    return zero;
+  }
+
+  auto seq = typename MP::sequence_type(allocator);
+  seq.reserve(n_terms);
+  auto positions = std::array<std::size_t, Dim>();
+  auto index     = typename MP::index_type();
+  for (std::size_t n = 0; n != n_terms; ++n) {
+    auto coeff = R(1);
+    for (std::size_t axis = 0; axis != Dim; ++axis) {
+      const auto& [i, c] = terms[axis][positions[axis]];
+      index[axis]        = i;
+      coeff *= c;
+    }
+    seq.emplace_back(index, coeff);
+    for (auto axis = Dim; axis-- != 0;) {
+      if (++positions[axis] != terms[axis].size()) {
+        break;
+      }
+      positions[axis] = 0;
+    }
+  }
+  auto p = MP(allocator);
+  p.adopt_sequence(ordered_unique_valid_range, std::move(seq));
+  return p;
+}
+
+/**
+ * \brief Factor p into a product of polynomials of each axis if it is separable.
+ * \details p is separable if and only if its indexes are the Cartesian product of the indexes of
+ * each axis and its coefficients are the products of the coefficients of each axis. The factors
+ * are read from the slices of p through its term of the greatest absolute coefficient, and each
+ * term is checked within the relative tolerance. The first factor carries the scale.
+ * \return the product, or std::nullopt if p isn't separable. A polynomial whose coefficients are
+ * all zero is factored into a zero first factor and the other factors of 1.
+ */
+template <
+    std::signed_integral IntType,
+    std::floating_point  R,
+    int                  D,
+    class Comparer,
+    class AllocatorOrContainer,
+    class Validation>
+auto TryFactor(
+    const MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>& p,
+    R relative_tolerance = 64 * std::numeric_limits<R>::epsilon()
+) {
+  using MP      = MVPolynomial<IntType, R, D, Comparer, AllocatorOrContainer, Validation>;
+  using Alloc   = typename std::allocator_traits<
+      typename MP::allocator_type>::template rebind_alloc<std::pair<IntType, R>>;
+  using Poly    = DefaultPolynomial<IntType, R, Alloc>;
+  using Product = PolynomialProduct<Poly, static_cast<std::size_t>(D)>;
+
+  const auto allocator = Alloc(p.get_allocator());
+
+  const auto pivot = std::max_element(p.begin(), p.end(), [](const auto& l, const auto& r) {
+    return std::abs(l.second) < std::abs(r.second);
+  });
+  if (pivot == p.end() || pivot->second == 0) {
+    return std::optional<Product>(Product::Generate([&allocator](std::size_t axis) {
+      auto factor = Poly(allocator);
+      factor[0]   = axis == 0 ? R(0) : R(1);
+      return factor;
+    }));
+  }
+  const auto& pivot_index = pivot->first;
+  const auto  pivot_coeff = pivot->second;
+
+  // The indexes must be the Cartesian product of the indexes of each axis.
+  auto n_products = std::size_t(1);
+  auto exponents  = std::vector<
+      IntType,
+      typename std::allocator_traits<Alloc>::template rebind_alloc<IntType>>(allocator);
+  exponents.reserve(p.size());
+  for (int axis = 0; axis != D; ++axis) {
+    exponents.clear();
+    for (const auto& index_and_value : p) {
+      exponents.push_back(index_and_value.first[axis]);
+    }
+    std::sort(exponents.begin(), exponents.end());
+    n_products *= static_cast<std::size_t>(
+        std::unique(exponents.begin(), exponents.end()) - exponents.begin()
+    );
+    if (n_products > p.size()) {
+      return std::optional<Product>();
+    }
+  }
+  if (n_products != p.size()) {
+    return std::optional<Product>();
+  }
+
+  // The factor of each axis is the slice of p through the pivot along the axis.
+  auto product = Product::Generate([&](std::size_t axis) {
+    auto factor = Poly(allocator);
+    auto index  = typename MP::index_type(pivot_index);
+    for (const auto& index_and_value : p) {
+      index[axis] = index_and_value.first[axis];
+      if (factor.find(index[axis]) == factor.end()) {
+        const auto coeff    = p.at(index);
+        factor[index[axis]] = axis == 0 ? coeff : coeff / pivot_coeff;
+      }
+    }
+    return factor;
+  });
+
+  for (const auto& [index, value] : p) {
+    auto coeff = R(1);
+    for (int axis = 0; axis != D; ++axis) {
+      coeff *= product[axis].at(index[axis]);
+    }
+    if (std::abs(coeff - value) > relative_tolerance * std::abs(value)) {
+      return std::optional<Product>();
+    }
+  }
+  return std::optional<Product>(std::move(product));
 }
 }  // namespace mvPolynomial
 
@@ -0,0 +1,253 @@
+#ifndef _MVPOLYNOMIAL_POLYNOMIAL_PRODUCT_SUM_HPP_
+#define _MVPOLYNOMIAL_POLYNOMIAL_PRODUCT_SUM_HPP_
+
+#include "mvPolynomial/type.hpp"
+#include "mvPolynomial/polynomial_product.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "Eigen/Core"
+
+namespace mvPolynomial {
+/**
+ * \brief A class implementing a sum of products of polynomials which have different variable each
+ * other (example: (1 + x) * (1 + y^2) + x^3 * (2 - y)), which is a separated representation of
+ * low rank.
+ * \details Calculating it costs the rank times the sum of the degrees of the polynomials instead
+ * of the number of terms of its expansion. The rank is the number of products, which sums add
+ * and products multiply. compress() merges the products which differ in at most one polynomial,
+ * which the operators call to keep the rank low.
+ */
+template <class P, std::size_t Dim>
+class PolynomialProductSum {
+ public:
+  static constexpr std::size_t dim = Dim;
+
+  using product_type    = PolynomialProduct<P, Dim>;
+  using polynomial_type = P;
+  using mapped_type     = typename polynomial_type::mapped_type;
+  using coord_type      = typename product_type::coord_type;
+
+ private:
+  using ProductContainer = std::vector<product_type>;
+
+ public:
+  using value_type      = typename ProductContainer::value_type;
+  using reference       = typename ProductContainer::reference;
+  using const_reference = typename ProductContainer::const_reference;
+  using iterator        = typename ProductContainer::iterator;
+  using const_iterator  = typename ProductContainer::const_iterator;
+  using size_type       = typename ProductContainer::size_type;
+
+  /**
+   * \brief Make a zero, which has no product.
+   */
+  PolynomialProductSum() = default;
+
+  explicit PolynomialProductSum(product_type p) { products_.push_back(std::move(p)); }
+
+  template <typename InputIterator>
+  PolynomialProductSum(InputIterator s, InputIterator e) : products_(s, e) {}
+
+  explicit PolynomialProductSum(std::initializer_list<product_type> l) : products_(l) {}
+
+  PolynomialProductSum(const PolynomialProductSum&)            = default;
+  PolynomialProductSum(PolynomialProductSum&&)                 = default;
+  PolynomialProductSum& operator=(const PolynomialProductSum&) = default;
+  PolynomialProductSum& operator=(PolynomialProductSum&&)      = default;
+  virtual ~PolynomialProductSum()                              = default;
+
+  reference       operator[](size_type n) { return products_[n]; }
+  const_reference operator[](size_type n) const { return products_[n]; }
+
+  iterator       begin() noexcept { return products_.begin(); }
+  const_iterator begin() const noexcept { return products_.begin(); }
+
+  iterator       end() noexcept { return products_.end(); }
+  const_iterator end() const noexcept { return products_.end(); }
+
+  bool      empty() const noexcept { return products_.empty(); }
+  size_type rank() const noexcept { return products_.size(); }
+
+  void push_back(product_type p) { products_.push_back(std::move(p)); }
+  void reserve(size_type n) { products_.reserve(n); }
+  void clear() noexcept { products_.clear(); }
+
+  /**
+   * \brief Merge the products which differ in at most one polynomial into one and remove the
+   * products which have a polynomial whose coefficients are all zero.
+   * \details (a * b) + (a * c) is merged into a * (b + c), and merging is repeated until no
+   * products can be merged, so it never changes the value.
+   */
+  void compress() {
+    std::erase_if(products_, HasZeroPolynomial);
+    for (auto merged = true; merged;) {
+      merged = false;
+      for (size_type i = 0; i < products_.size(); ++i) {
+        for (size_type j = i + 1; j < products_.size();) {
+          if (const auto axis = DifferentAxis(products_[i], products_[j])) {
+            products_[i][*axis] += products_[j][*axis];
+            products_.erase(products_.begin() + j);
+            merged = true;
+          } else {
+            ++j;
+          }
+        }
+      }
+      std::erase_if(products_, HasZeroPolynomial);
+    }
+  }
+
+  PolynomialProductSum operator+() const { return *this; }
+
+  PolynomialProductSum operator-() const {
+    auto m = *this;
+    for (auto& p : m.products_) {
+      p[0] *= mapped_type(-1);
+    }
+    return m;
+  }
+
+  PolynomialProductSum& operator+=(const PolynomialProductSum& r) {
+    if (this == &r) {
+      return *this *= mapped_type(2);
+    }
+    products_.insert(products_.end(), r.products_.begin(), r.products_.end());
+    compress();
+    return *this;
+  }
+
+  PolynomialProductSum& operator-=(const PolynomialProductSum& r) {
+    if (this == &r) {
+      return *this *= mapped_type(0);
+    }
+    return *this += -r;
+  }
+
+  PolynomialProductSum& operator*=(mapped_type r) {
+    for (auto& p : products_) {
+      p[0] *= r;
+    }
+    compress();
+    return *this;
+  }
+
+  friend PolynomialProductSum operator+(PolynomialProductSum l, const PolynomialProductSum& r) {
+    return l += r;
+  }
+
+  friend PolynomialProductSum operator-(PolynomialProductSum l, const PolynomialProductSum& r) {
+    return l -= r;
+  }
+
+  /**
+   * \brief Multiply each product of l by each product of r, so the rank is at most the product
+   * of the ranks.
+   */
+  friend PolynomialProductSum operator*(
+      const PolynomialProductSum& l, const PolynomialProductSum& r
+  ) {
+    auto mul = PolynomialProductSum();
+    mul.reserve(l.rank() * r.rank());
+    for (const auto& lp : l) {
+      for (const auto& rp : r) {
+        mul.push_back(lp * rp);
+      }
+    }
+    mul.compress();
+    return mul;
+  }
+
+ private:
+  static bool HasZeroPolynomial(const product_type& p) {
+    return std::any_of(p.begin(), p.end(), [](const polynomial_type& q) {
+      return std::all_of(q.begin(), q.end(), [](const auto& index_and_value) {
+        return index_and_value.second == 0;
+      });
+    });
+  }
+
+  /**
+   * \brief Return the only axis whose polynomials differ (0 if no polynomial differs), or
+   * std::nullopt if the polynomials of more than one axis differ.
+   */
+  static std::optional<std::size_t> DifferentAxis(const product_type& l, const product_type& r) {
+    auto axis = std::optional<std::size_t>();
+    for (std::size_t i = 0; i != dim; ++i) {
+      if (l[i] != r[i]) {
+        if (axis) {
+          return std::nullopt;
+        }
+        axis = i;
+      }
+    }
+    return axis ? axis : std::optional<std::size_t>(0);
+  }
+
+  ProductContainer products_;
+};
+
+template <class P, std::size_t Dim>
+auto Of(
+    const PolynomialProductSum<P, Dim>&                      s,
+    const typename PolynomialProductSum<P, Dim>::coord_type& x
+) {
+  auto sum = typename PolynomialProductSum<P, Dim>::mapped_type(0);
+  for (const auto& p : s) {
+    sum += Of(p, x);
+  }
+  return sum;
+}
+
+/**
+ * \brief Calculate s at each column of xs.
+ * \details Each polynomial is calculated at all points at once by Of of a row array.
+ */
+template <class P, std::size_t Dim>
+auto Of(
+    const PolynomialProductSum<P, Dim>&                                   s,
+    const CoordArrayType<typename P::mapped_type, static_cast<int>(Dim)>& xs
+) {
+  using Values = ValueArrayType<typename P::mapped_type>;
+
+  Values values  = Values::Zero(xs.cols());
+  Values product = Values(xs.cols());
+  for (const auto& p : s) {
+    product.setOnes();
+    for (std::size_t axis = 0; axis != Dim; ++axis) {
+      product *= Of(p[axis], xs.row(axis));
+    }
+    values += product;
+  }
+  return values;
+}
+
+template <class P, std::size_t Dim>
+auto D(const PolynomialProductSum<P, Dim>& s, std::size_t axis) {
+  auto d = PolynomialProductSum<P, Dim>();
+  d.reserve(s.rank());
+  for (const auto& p : s) {
+    d.push_back(D(p, axis));
+  }
+  d.compress();
+  return d;
+}
+
+template <class P, std::size_t Dim>
+auto Integrate(const PolynomialProductSum<P, Dim>& s, std::size_t axis) {
+  auto integral = PolynomialProductSum<P, Dim>();
+  integral.reserve(s.rank());
+  for (const auto& p : s) {
+    integral.push_back(Integrate(p, axis));
+  }
+  integral.compress();
+  return integral;
+}
+}  // namespace mvPolynomial
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef _MVPOLYNOMIAL_POW_HPP_
+#define _MVPOLYNOMIAL_POW_HPP_
+
+#include <concepts>
+
+#include "Eigen/Core"
+
+namespace mvPolynomial {
+/**
+ * \brief Calculate x to the power of n by repeated squaring.
+ * \param[in] x a base.
+ * \param[in] n a non-negative exponent.
+ */
+template <std::floating_point R, std::integral IntType>
+constexpr R Pow(R x, IntType n) noexcept {
+  auto result = R(1);
+  while (n > 0) {
+    if (n & 1) {
+      result *= x;
+    }
+    n >>= 1;
+    if (n > 0) {
+      x *= x;
+    }
+  }
+  return result;
+}
+
+/**
+ * \brief Multiply c by x to the power of n and its derivative dc by the derivative of the product.
+ * \details It is a step of Horner's method which also calculates the derivative.
+ * \param[in,out] c a value.
+ * \param[in,out] dc the derivative of c.
+ * \param[in] x a base.
+ * \param[in] n a non-negative exponent.
+ */
+template <std::floating_point R, std::integral IntType>
+constexpr void HornerStep(R& c, R& dc, R x, IntType n) noexcept {
+  if (n == 0) {
+    return;
+  }
+  const auto x_n_1 = Pow(x, n - 1);
+  dc               = dc * x_n_1 * x + c * n * x_n_1;
+  c *= x_n_1 * x;
+}
+
+/**
+ * \brief Calculate each element of x to the power of n by repeated squaring.
+ * \details The multiplications are the same as the scalar version, so the results are
+ * bit-identical to it while Eigen vectorizes them across the elements.
+ * \param[in] x bases.
+ * \param[in] n a non-negative exponent.
+ */
+template <class Derived, std::integral IntType>
+auto Pow(const Eigen::ArrayBase<Derived>& x, IntType n) {
+  using Plain = typename Derived::PlainObject;
+
+  Plain result = Plain::Ones(x.rows(), x.cols());
+  Plain base   = x;
+  while (n > 0) {
+    if (n & 1) {
+      result *= base;
+    }
+    n >>= 1;
+    if (n > 0) {
+      base *= base;
+    }
+  }
+  return result;
+}
+}  // namespace mvPolynomial
+
+#endif
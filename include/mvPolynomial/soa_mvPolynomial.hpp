@@ -0,0 +1,701 @@
+#ifndef _MVPOLYNOMIAL_SOA_MVPOLYNOMIAL_HPP_
+#define _MVPOLYNOMIAL_SOA_MVPOLYNOMIAL_HPP_
+
+#include "mvPolynomial/type.hpp"
+#include "mvPolynomial/index_comparer.hpp"
+#include "mvPolynomial/multiplication.hpp"
+#include "mvPolynomial/pow.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "boost/container/flat_map.hpp"
+#include "boost/iterator/iterator_facade.hpp"
+#include "Eigen/Core"
+#include "fmt/core.h"
+
+namespace mvPolynomial {
+/**
+ * \brief A multivariable polynomial which stores its indexes as a packed D x N matrix and its
+ * coefficients as a separate contiguous array (structure of arrays).
+ * \details The interface is the same as MVPolynomial except that dereferencing an iterator returns
+ * a pair of a map to the index and a reference to the coefficient by value. So, bind it by
+ * `auto [index, value] = *it` or `auto&& [index, value] = *it`.
+ * Passes over coefficients only, like scaling, negation and integration, don't touch the indexes
+ * and are vectorized by Eigen.
+ */
+template <
+    std::signed_integral IntType,
+    std::floating_point  R,
+    int                  Dim,
+    class Comparer = IndexComparer<IntType, Dim>,
+    class AllocatorOrContainer = std::allocator<std::pair<IndexType<IntType, Dim>, R>>>
+class SoAMVPolynomial {
+ public:
+  static_assert(Dim > 0, "SoAMVPolynomial: the dimension must be greater than 0.");
+
+  static constexpr int dim = Dim;
+
+  using index_type = IndexType<IntType, dim>;
+  using coord_type = CoordType<R, dim>;
+
+ private:
+  using alloc_traits      = std::allocator_traits<AllocatorOrContainer>;
+  using IndexContainer    = std::vector<IntType, typename alloc_traits::rebind_alloc<IntType>>;
+  using CoeffContainer    = std::vector<R, typename alloc_traits::rebind_alloc<R>>;
+  using IndexMap          = Eigen::Map<const index_type>;
+  using IndexMatrix       = Eigen::Array<IntType, dim, Eigen::Dynamic>;
+  using CoefficientVector = Eigen::Array<R, Eigen::Dynamic, 1>;
+  // Whether adding the same index to two indexes keeps their order.
+  using IsTranslationInvariant = std::is_same<Comparer, IndexComparer<IntType, dim>>;
+
+  template <bool IsConst>
+  class Iterator
+      : public boost::iterator_facade<
+            Iterator<IsConst>,
+            std::pair<index_type, R>,
+            std::random_access_iterator_tag,
+            std::pair<IndexMap, std::conditional_t<IsConst, const R&, R&>>> {
+   public:
+    using index_pointer = const IntType*;
+    using coeff_pointer = std::conditional_t<IsConst, const R*, R*>;
+
+    Iterator() = default;
+
+    Iterator(index_pointer i, coeff_pointer c) : index_(i), coeff_(c) {}
+
+    template <bool OtherIsConst>
+      requires(IsConst && !OtherIsConst)
+    Iterator(const Iterator<OtherIsConst>& other) : index_(other.index_), coeff_(other.coeff_) {}
+
+   private:
+    friend class boost::iterator_core_access;
+    template <bool>
+    friend class Iterator;
+
+    using base_type = boost::iterator_facade<
+        Iterator<IsConst>,
+        std::pair<index_type, R>,
+        std::random_access_iterator_tag,
+        std::pair<IndexMap, std::conditional_t<IsConst, const R&, R&>>>;
+
+    typename base_type::reference dereference() const {
+      return typename base_type::reference(IndexMap(index_), *coeff_);
+    }
+
+    template <bool OtherIsConst>
+    bool equal(const Iterator<OtherIsConst>& other) const {
+      return coeff_ == other.coeff_;
+    }
+
+    void increment() {
+      index_ += dim;
+      ++coeff_;
+    }
+
+    void decrement() {
+      index_ -= dim;
+      --coeff_;
+    }
+
+    void advance(typename base_type::difference_type n) {
+      index_ += n * dim;
+      coeff_ += n;
+    }
+
+    template <bool OtherIsConst>
+    typename base_type::difference_type distance_to(const Iterator<OtherIsConst>& other) const {
+      return other.coeff_ - coeff_;
+    }
+
+    index_pointer index_{nullptr};
+    coeff_pointer coeff_{nullptr};
+  };
+
+ public:
+  using key_type    = index_type;
+  using mapped_type = R;
+  using value_type  = std::pair<index_type, R>;
+
+  using key_compare = Comparer;
+
+  using allocator_type = AllocatorOrContainer;
+
+  using size_type       = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  using iterator               = Iterator<false>;
+  using const_iterator         = Iterator<true>;
+  using reverse_iterator       = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  explicit SoAMVPolynomial(const allocator_type& allocator)
+      : indexes_(allocator), coeffs_(allocator) {
+    PushBack(index_type::Zero(), 0);
+  }
+
+  explicit SoAMVPolynomial(const Comparer& comparer) : comparer_(comparer) {
+    PushBack(index_type::Zero(), 0);
+  }
+
+  explicit SoAMVPolynomial(const Comparer& comparer, const allocator_type& allocator)
+      : comparer_(comparer), indexes_(allocator), coeffs_(allocator) {
+    PushBack(index_type::Zero(), 0);
+  }
+
+  template <typename InputIterator>
+  SoAMVPolynomial(InputIterator s, InputIterator e) {
+    Assign(s, e);
+  }
+
+  template <typename InputIterator>
+  explicit SoAMVPolynomial(InputIterator s, InputIterator e, const allocator_type& allocator)
+      : indexes_(allocator), coeffs_(allocator) {
+    Assign(s, e);
+  }
+
+  template <typename InputIterator>
+  explicit SoAMVPolynomial(InputIterator s, InputIterator e, const Comparer& c) : comparer_(c) {
+    Assign(s, e);
+  }
+
+  template <typename InputIterator>
+  explicit SoAMVPolynomial(
+      InputIterator s, InputIterator e, const Comparer& c, const allocator_type& a
+  )
+      : comparer_(c), indexes_(a), coeffs_(a) {
+    Assign(s, e);
+  }
+
+  template <typename InputIterator>
+  explicit SoAMVPolynomial(
+      boost::container::ordered_unique_range_t,
+      InputIterator s,
+      InputIterator e,
+      const Comparer&       c = Comparer(),
+      const allocator_type& a = allocator_type()
+  )
+      : comparer_(c), indexes_(a), coeffs_(a) {
+    AssignOrdered(s, e);
+  }
+
+  explicit SoAMVPolynomial(std::initializer_list<value_type> l) { Assign(l.begin(), l.end()); }
+
+  explicit SoAMVPolynomial(std::initializer_list<value_type> l, const Comparer& c)
+      : comparer_(c) {
+    Assign(l.begin(), l.end());
+  }
+
+  /**
+   * \brief Convert a polynomial stored as a flat_map (ex. MVPolynomial) into this layout.
+   */
+  template <class Polynomial>
+    requires(
+        !std::same_as<Polynomial, SoAMVPolynomial>
+        && std::same_as<typename Polynomial::key_compare, Comparer>
+    )
+  explicit SoAMVPolynomial(const Polynomial& p, const allocator_type& a = allocator_type())
+      : comparer_(p.key_comp()), indexes_(a), coeffs_(a) {
+    AssignOrdered(p.begin(), p.end());
+  }
+
+  SoAMVPolynomial& operator=(std::initializer_list<value_type> l) {
+    Assign(l.begin(), l.end());
+    return *this;
+  }
+
+  explicit SoAMVPolynomial(mapped_type r) { PushBack(index_type::Zero(), r); }
+
+  SoAMVPolynomial() { PushBack(index_type::Zero(), 0); }
+  SoAMVPolynomial(const SoAMVPolynomial& other)            = default;
+  SoAMVPolynomial& operator=(const SoAMVPolynomial& other) = default;
+  SoAMVPolynomial(SoAMVPolynomial&& other)                 = default;
+  SoAMVPolynomial& operator=(SoAMVPolynomial&& other)      = default;
+  virtual ~SoAMVPolynomial()                               = default;
+
+  static void CheckAxis(std::size_t axis) {
+    if (axis >= dim) {
+      throw std::runtime_error(
+          fmt::format("CheckAxis: Given axis {} must be in [0, {}).", axis, dim)
+      );
+    }
+  }
+
+  allocator_type get_allocator() const noexcept { return allocator_type(coeffs_.get_allocator()); }
+
+  iterator       begin() noexcept { return iterator(indexes_.data(), coeffs_.data()); }
+  const_iterator begin() const noexcept { return const_iterator(indexes_.data(), coeffs_.data()); }
+
+  iterator end() noexcept {
+    return iterator(indexes_.data() + indexes_.size(), coeffs_.data() + coeffs_.size());
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(indexes_.data() + indexes_.size(), coeffs_.data() + coeffs_.size());
+  }
+
+  reverse_iterator       rbegin() noexcept { return reverse_iterator(end()); }
+  const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+
+  reverse_iterator       rend() noexcept { return reverse_iterator(begin()); }
+  const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+  const_reverse_iterator crend() const noexcept { return rend(); }
+
+  bool empty() const noexcept { return coeffs_.empty(); }
+
+  size_type size() const noexcept { return coeffs_.size(); }
+
+  size_type max_size() const noexcept { return coeffs_.max_size(); }
+
+  size_type capacity() const noexcept { return coeffs_.capacity(); }
+
+  void reserve(size_type size) {
+    indexes_.reserve(size * dim);
+    coeffs_.reserve(size);
+  }
+
+  void shrink_to_fit() {
+    indexes_.shrink_to_fit();
+    coeffs_.shrink_to_fit();
+  }
+
+  /**
+   * \brief Return the indexes as a D x N matrix.
+   */
+  auto indexes() const noexcept {
+    return Eigen::Map<const IndexMatrix>(indexes_.data(), dim, size());
+  }
+
+  /**
+   * \brief Return the coefficients as an array.
+   */
+  auto coefficients() noexcept { return Eigen::Map<CoefficientVector>(coeffs_.data(), size()); }
+  auto coefficients() const noexcept {
+    return Eigen::Map<const CoefficientVector>(coeffs_.data(), size());
+  }
+
+  mapped_type& operator[](const key_type& index) {
+    auto position = LowerBound(index);
+    if (position == size() || comparer_(index, IndexAt(position))) {
+      CheckIndex(index);
+      Insert(position, index, 0);
+    }
+    return coeffs_[position];
+  }
+
+  const mapped_type& operator[](const key_type& index) const {
+    return const_cast<SoAMVPolynomial*>(this)->operator[](index);
+  }
+
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const key_type& i, M&& m) {
+    auto [it, is_inserted] = insert(value_type(i, m));
+    if (!is_inserted) {
+      (*it).second = std::forward<M>(m);
+    }
+    return {it, is_inserted};
+  }
+
+  iterator       nth(size_type n) noexcept { return std::next(begin(), n); }
+  const_iterator nth(size_type n) const noexcept { return std::next(begin(), n); }
+
+  size_type index_of(const_iterator ci) const noexcept { return std::distance(begin(), ci); }
+
+  mapped_type& at(const key_type& i) {
+    auto position = Find(i);
+    if (position == size()) {
+      throw std::out_of_range("SoAMVPolynomial::at: key not found");
+    }
+    return coeffs_[position];
+  }
+  const mapped_type& at(const key_type& i) const {
+    return const_cast<SoAMVPolynomial*>(this)->at(i);
+  }
+
+  std::pair<iterator, bool> insert(const value_type& i_and_v) {
+    const auto& [index, value] = i_and_v;
+    auto position              = LowerBound(index);
+    if (position != size() && !comparer_(index, IndexAt(position))) {
+      return {nth(position), false};
+    }
+    CheckIndex(index);
+    Insert(position, index, value);
+    return {nth(position), true};
+  }
+
+  /**
+   * \brief Insert the terms whose indexes this polynomial doesn't have.
+   * \details The new terms are sorted and merged at once, so it costs O(n + m log m) for m terms.
+   * The existing term or the first one of the new terms which have the same index is kept.
+   */
+  template <typename InputIterator>
+  void insert(InputIterator s, InputIterator e) {
+    auto seq = SortUnique(s, e);
+    if (seq.empty()) {
+      return;
+    }
+    auto merged = SoAMVPolynomial(comparer_, get_allocator());
+    merged.clear();
+    merged.reserve(size() + seq.size());
+    size_type i = 0;
+    auto      j = seq.cbegin();
+    // Like Merge sort algorithm, keep the existing term when the indexes are the same.
+    while (i != size() && j != seq.cend()) {
+      auto idx = index_type(IndexAt(i));
+      if (comparer_(idx, j->first)) {
+        merged.PushBack(idx, coeffs_[i++]);
+      } else if (comparer_(j->first, idx)) {
+        CheckIndex(j->first);
+        merged.PushBack(j->first, j->second);
+        ++j;
+      } else {
+        merged.PushBack(idx, coeffs_[i++]);
+        ++j;
+      }
+    }
+    for (; i != size(); ++i) {
+      merged.PushBack(IndexAt(i), coeffs_[i]);
+    }
+    for (; j != seq.cend(); ++j) {
+      CheckIndex(j->first);
+      merged.PushBack(j->first, j->second);
+    }
+    swap(merged);
+  }
+
+  void insert(std::initializer_list<value_type> l) { insert(l.begin(), l.end()); }
+
+  iterator erase(const_iterator ci) { return erase(ci, std::next(ci)); }
+
+  size_type erase(const key_type& i) {
+    auto position = Find(i);
+    if (position == size()) {
+      return 0;
+    }
+    erase(nth(position));
+    return 1;
+  }
+
+  iterator erase(const_iterator s, const_iterator e) {
+    auto first = index_of(s);
+    auto last  = index_of(e);
+    indexes_.erase(
+        std::next(indexes_.begin(), first * dim),
+        std::next(indexes_.begin(), last * dim)
+    );
+    coeffs_.erase(std::next(coeffs_.begin(), first), std::next(coeffs_.begin(), last));
+    return nth(first);
+  }
+
+  void swap(SoAMVPolynomial& m) {
+    std::swap(comparer_, m.comparer_);
+    indexes_.swap(m.indexes_);
+    coeffs_.swap(m.coeffs_);
+  }
+
+  void clear() noexcept {
+    indexes_.clear();
+    coeffs_.clear();
+  }
+
+  key_compare key_comp() const { return comparer_; }
+
+  iterator       find(const key_type& i) { return nth(Find(i)); }
+  const_iterator find(const key_type& i) const { return nth(Find(i)); }
+
+  size_type count(const key_type& i) const { return Find(i) == size() ? 0 : 1; }
+
+  bool contains(const key_type& i) const { return Find(i) != size(); }
+
+  iterator       lower_bound(const key_type& i) { return nth(LowerBound(i)); }
+  const_iterator lower_bound(const key_type& i) const { return nth(LowerBound(i)); }
+
+  iterator       upper_bound(const key_type& i) { return nth(UpperBound(i)); }
+  const_iterator upper_bound(const key_type& i) const { return nth(UpperBound(i)); }
+
+  std::pair<iterator, iterator> equal_range(const key_type& i) {
+    return {lower_bound(i), upper_bound(i)};
+  }
+
+  std::pair<const_iterator, const_iterator> equal_range(const key_type& i) const {
+    return {lower_bound(i), upper_bound(i)};
+  }
+
+  auto front() { return *begin(); }
+  auto front() const { return *cbegin(); }
+
+  auto back() { return *rbegin(); }
+  auto back() const { return *crbegin(); }
+
+  SoAMVPolynomial operator+() const { return *this; }
+
+  SoAMVPolynomial operator-() const {
+    auto m           = SoAMVPolynomial(*this);
+    m.coefficients() = -m.coefficients();
+    return m;
+  }
+
+  SoAMVPolynomial& operator*=(mapped_type r) {
+    coefficients() *= r;
+    return *this;
+  }
+
+  // friend functions
+  // TODO consider tolerance.
+  friend bool operator==(const SoAMVPolynomial& l, const SoAMVPolynomial& r) {
+    return l.indexes_ == r.indexes_ && l.coeffs_ == r.coeffs_;
+  }
+
+  // TODO consider tolerance.
+  friend bool operator!=(const SoAMVPolynomial& l, const SoAMVPolynomial& r) { return !(l == r); }
+
+  friend SoAMVPolynomial operator+(const SoAMVPolynomial& l, const SoAMVPolynomial& r) {
+    return Merge(l, r, R(1));
+  }
+
+  friend SoAMVPolynomial operator-(const SoAMVPolynomial& l, const SoAMVPolynomial& r) {
+    return Merge(l, r, R(-1));
+  }
+
+  friend SoAMVPolynomial operator*(const SoAMVPolynomial& l, const SoAMVPolynomial& r) {
+    const auto& comparer = l.comparer_;
+    auto        product  = SoAMVPolynomial(comparer, l.get_allocator());
+    product.clear();
+    if constexpr (std::is_same_v<Comparer, IndexComparer<IntType, Dim>>) {
+      // IndexComparer keeps the order of indexes when they are added to the same index.
+      const auto& small = l.size() <= r.size() ? l : r;
+      const auto& large = l.size() <= r.size() ? r : l;
+      HeapMultiply(
+          small.size(),
+          large.size(),
+          [&small, &large](std::size_t i, std::size_t j) {
+            return std::pair<index_type, R>(
+                small.IndexAt(i) + large.IndexAt(j), small.coeffs_[i] * large.coeffs_[j]
+            );
+          },
+          comparer,
+          [&product](const index_type& index, R value) { product.PushBack(index, value); },
+          l.get_allocator()
+      );
+      return product;
+    }
+
+    // Calculate all product of each l's term and r's term.
+    auto mul = std::vector<value_type, typename alloc_traits::rebind_alloc<value_type>>(
+        l.get_allocator()
+    );
+    mul.reserve(l.size() * r.size());
+    for (size_type i = 0; i != l.size(); ++i) {
+      for (size_type j = 0; j != r.size(); ++j) {
+        mul.emplace_back(l.IndexAt(i) + r.IndexAt(j), l.coeffs_[i] * r.coeffs_[j]);
+      }
+    }
+    std::sort(mul.begin(), mul.end(), [&comparer](const value_type& a, const value_type& b) {
+      return comparer(a.first, b.first);
+    });
+    product.reserve(mul.size());
+    for (const auto& [index, value] : mul) {
+      if (!product.empty() && (product.IndexAt(product.size() - 1) == index).all()) {
+        product.coeffs_.back() += value;
+      } else {
+        product.PushBack(index, value);
+      }
+    }
+    return product;
+  }
+
+  friend void swap(SoAMVPolynomial& l, SoAMVPolynomial& r) { l.swap(r); }
+
+  friend SoAMVPolynomial D(const SoAMVPolynomial& p, std::size_t axis) {
+    CheckAxis(axis);
+
+    auto dp = SoAMVPolynomial(p.comparer_, p.get_allocator());
+    dp.clear();
+    dp.reserve(p.size());
+    for (size_type i = 0; i != p.size(); ++i) {
+      auto index = index_type(p.IndexAt(i));
+      if (index[axis] == 0) {
+        continue;
+      }
+      auto value = p.coeffs_[i] * index[axis]--;
+      dp.PushBack(index, value);
+    }
+    dp.SortIfNeeded();
+    return dp;
+  }
+
+  friend SoAMVPolynomial Integrate(SoAMVPolynomial p, std::size_t axis) {
+    CheckAxis(axis);
+
+    auto indexes = Eigen::Map<IndexMatrix>(p.indexes_.data(), dim, p.size());
+    indexes.row(axis) += 1;
+    p.coefficients() /= indexes.row(axis).transpose().template cast<R>();
+    p.SortIfNeeded();
+    return p;
+  }
+
+  friend R Of(const SoAMVPolynomial& p, const coord_type& x) {
+    auto sum = R(0);
+    for (size_type i = 0; i != p.size(); ++i) {
+      auto monomial = p.coeffs_[i];
+      for (auto axis = 0; axis != dim; ++axis) {
+        monomial *= Pow(x[axis], p.indexes_[i * dim + axis]);
+      }
+      sum += monomial;
+    }
+    return sum;
+  }
+
+ private:
+  static void CheckIndex(const key_type& index) {
+    if ((index < index_type::Zero()).any()) {
+      auto err_msg_stream = std::stringstream();
+      for (auto i = 0; i != index.size() - 1; ++i) {
+        err_msg_stream << index[i] << ", ";
+      }
+      err_msg_stream << index[index.size() - 1];
+
+      throw std::runtime_error(
+          fmt::format("Each element of the index ({}) must be non-negative.", err_msg_stream.str())
+      );
+    }
+  }
+
+  static SoAMVPolynomial Merge(const SoAMVPolynomial& l, const SoAMVPolynomial& r, R sign) {
+    const auto& comparer = l.comparer_;
+    auto        merged   = SoAMVPolynomial(comparer, l.get_allocator());
+    merged.clear();
+    merged.reserve(l.size() + r.size());
+    size_type i = 0;
+    size_type j = 0;
+    // Like Merge sort algorithm, insert or sum data to merged.
+    while (i != l.size() && j != r.size()) {
+      auto l_idx = index_type(l.IndexAt(i));
+      auto r_idx = index_type(r.IndexAt(j));
+      if (comparer(l_idx, r_idx)) {
+        merged.PushBack(l_idx, l.coeffs_[i++]);
+      } else if (comparer(r_idx, l_idx)) {
+        merged.PushBack(r_idx, sign * r.coeffs_[j++]);
+      } else {
+        merged.PushBack(l_idx, l.coeffs_[i++] + sign * r.coeffs_[j++]);
+      }
+    }
+    for (; i != l.size(); ++i) {
+      merged.PushBack(l.IndexAt(i), l.coeffs_[i]);
+    }
+    for (; j != r.size(); ++j) {
+      merged.PushBack(r.IndexAt(j), sign * r.coeffs_[j]);
+    }
+    return merged;
+  }
+
+  IndexMap IndexAt(size_type i) const { return IndexMap(indexes_.data() + i * dim); }
+
+  template <class Index>
+  void PushBack(const Index& index, R value) {
+    indexes_.insert(indexes_.end(), index.begin(), index.end());
+    coeffs_.push_back(value);
+  }
+
+  void Insert(size_type position, const key_type& index, R value) {
+    indexes_.insert(std::next(indexes_.begin(), position * dim), index.begin(), index.end());
+    coeffs_.insert(std::next(coeffs_.begin(), position), value);
+  }
+
+  size_type LowerBound(const key_type& index) const {
+    auto positions = std::views::iota(size_type(0), size());
+    return *std::ranges::partition_point(positions, [this, &index](size_type i) {
+      return comparer_(IndexAt(i), index);
+    });
+  }
+
+  size_type UpperBound(const key_type& index) const {
+    auto positions = std::views::iota(size_type(0), size());
+    return *std::ranges::partition_point(positions, [this, &index](size_type i) {
+      return !comparer_(index, IndexAt(i));
+    });
+  }
+
+  size_type Find(const key_type& index) const {
+    auto position = LowerBound(index);
+    if (position != size() && comparer_(index, IndexAt(position))) {
+      return size();
+    }
+    return position;
+  }
+
+  /**
+   * \brief Copy the terms in order of comparer_ and keep the first one of each index.
+   */
+  template <typename InputIterator>
+  auto SortUnique(InputIterator s, InputIterator e) const {
+    auto seq = std::vector<value_type, typename alloc_traits::rebind_alloc<value_type>>(
+        s, e, get_allocator()
+    );
+    std::stable_sort(seq.begin(), seq.end(), [this](const value_type& l, const value_type& r) {
+      return comparer_(l.first, r.first);
+    });
+    // Keep the first one of the terms which have the same index like flat_map.
+    auto unique_end =
+        std::unique(seq.begin(), seq.end(), [](const value_type& l, const value_type& r) {
+          return (l.first == r.first).all();
+        });
+    seq.erase(unique_end, seq.end());
+    return seq;
+  }
+
+  template <typename InputIterator>
+  void Assign(InputIterator s, InputIterator e) {
+    auto seq = SortUnique(s, e);
+    AssignOrdered(seq.begin(), seq.end());
+  }
+
+  template <typename InputIterator>
+  void AssignOrdered(InputIterator s, InputIterator e) {
+    clear();
+    for (; s != e; ++s) {
+      const auto& [index, value] = *s;
+      CheckIndex(index);
+      PushBack(index, value);
+    }
+  }
+
+  // Only used after the indexes are changed by D or Integrate.
+  void SortIfNeeded() {
+    if constexpr (!IsTranslationInvariant::value) {
+      auto order = std::vector<size_type, typename alloc_traits::rebind_alloc<size_type>>(
+          size(), get_allocator()
+      );
+      std::iota(order.begin(), order.end(), size_type(0));
+      std::sort(order.begin(), order.end(), [this](size_type l, size_type r) {
+        return comparer_(IndexAt(l), IndexAt(r));
+      });
+      auto sorted = SoAMVPolynomial(comparer_, get_allocator());
+      sorted.clear();
+      sorted.reserve(size());
+      for (auto i : order) {
+        sorted.PushBack(IndexAt(i), coeffs_[i]);
+      }
+      swap(sorted);
+    }
+  }
+
+  Comparer       comparer_;
+  IndexContainer indexes_;
+  CoeffContainer coeffs_;
+};
+}  // namespace mvPolynomial
+
+#endif
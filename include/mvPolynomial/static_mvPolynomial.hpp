@@ -0,0 +1,391 @@
+#ifndef _MVPOLYNOMIAL_STATIC_MVPOLYNOMIAL_HPP_
+#define _MVPOLYNOMIAL_STATIC_MVPOLYNOMIAL_HPP_
+
+#include "mvPolynomial/mvPolynomial.hpp"
+#include "mvPolynomial/pow.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "fmt/core.h"
+
+namespace mvPolynomial {
+/**
+ * \brief A class implementing a multivariable polynomial whose number of terms is fixed at compile
+ * time.
+ * \details All members are literal, so a polynomial can be made, evaluated, differentiated and
+ * multiplied in constant expressions, and passed as a template argument (see Of<P>, D<P, Axis>
+ * and Product<L, R>), where the indexes are constants and the evaluation is straight-line code.
+ * The terms are in the same order as IndexComparer.
+ * The members are public so that it is a structural type, but must not be modified.
+ * \tparam N the number of terms.
+ */
+template <std::signed_integral IntType, std::floating_point R, int Dim, std::size_t N>
+class StaticMVPolynomial {
+ public:
+  static_assert(Dim > 0, "StaticMVPolynomial: the dimension must be greater than 0.");
+
+  static constexpr int dim = Dim;
+
+  using int_type    = IntType;
+  using mapped_type = R;
+  using index_type  = std::array<IntType, dim>;
+  using size_type   = std::size_t;
+
+  using runtime_type = DefaultMVPolynomial<IntType, R, dim>;
+
+  template <std::size_t M>
+  using rebind = StaticMVPolynomial<IntType, R, dim, M>;
+
+  constexpr StaticMVPolynomial() = default;
+
+  /**
+   * \brief Make a polynomial from distinct indexes and their coefficients in any order.
+   */
+  constexpr StaticMVPolynomial(
+      const std::array<index_type, N>& indexes, const std::array<R, N>& coefficients
+  ) {
+    auto order = std::array<std::size_t, N>();
+    for (std::size_t k = 0; k != N; ++k) {
+      order[k] = k;
+    }
+    std::sort(order.begin(), order.end(), [&indexes](std::size_t l, std::size_t r) {
+      return indexes[l] > indexes[r];
+    });
+    for (std::size_t k = 0; k != N; ++k) {
+      this->indexes[k]      = indexes[order[k]];
+      this->coefficients[k] = coefficients[order[k]];
+    }
+    Check();
+  }
+
+  /**
+   * \brief Copy the terms of p, which must have N terms.
+   */
+  template <class Comparer, class AllocatorOrContainer, class Validation>
+  explicit StaticMVPolynomial(
+      const MVPolynomial<IntType, R, dim, Comparer, AllocatorOrContainer, Validation>& p
+  ) {
+    if (p.size() != N) {
+      throw std::runtime_error(fmt::format(
+          "StaticMVPolynomial: The polynomial has {} terms, but {} terms are expected.", p.size(), N
+      ));
+    }
+    auto index_array = std::array<index_type, N>();
+    auto coeff_array = std::array<R, N>();
+    auto k           = std::size_t(0);
+    for (const auto& [index, value] : p) {
+      for (int axis = 0; axis != dim; ++axis) {
+        index_array[k][axis] = index[axis];
+      }
+      coeff_array[k++] = value;
+    }
+    *this = StaticMVPolynomial(index_array, coeff_array);
+  }
+
+  constexpr StaticMVPolynomial(const StaticMVPolynomial& other)            = default;
+  constexpr StaticMVPolynomial& operator=(const StaticMVPolynomial& other) = default;
+  constexpr StaticMVPolynomial(StaticMVPolynomial&& other)                 = default;
+  constexpr StaticMVPolynomial& operator=(StaticMVPolynomial&& other)      = default;
+  constexpr ~StaticMVPolynomial()                                          = default;
+
+  static constexpr size_type size() noexcept { return N; }
+
+  /**
+   * \brief Return the maximum degree of each axis.
+   */
+  constexpr index_type degrees() const noexcept {
+    auto result = index_type();
+    for (const auto& index : indexes) {
+      for (int axis = 0; axis != dim; ++axis) {
+        result[axis] = std::max(result[axis], index[axis]);
+      }
+    }
+    return result;
+  }
+
+  /**
+   * \brief Return the coefficient of the index, or 0 if it isn't a term.
+   */
+  constexpr R at(const index_type& index) const noexcept {
+    for (std::size_t k = 0; k != N; ++k) {
+      if (indexes[k] == index) {
+        return coefficients[k];
+      }
+    }
+    return R(0);
+  }
+
+  runtime_type ToMVPolynomial() const {
+    auto seq = typename runtime_type::sequence_type();
+    seq.reserve(N);
+    for (std::size_t k = 0; k != N; ++k) {
+      auto index = typename runtime_type::index_type();
+      for (int axis = 0; axis != dim; ++axis) {
+        index[axis] = indexes[k][axis];
+      }
+      seq.emplace_back(index, coefficients[k]);
+    }
+    auto p = runtime_type();
+    p.adopt_sequence(ordered_unique_valid_range, std::move(seq));
+    return p;
+  }
+
+  constexpr bool operator==(const StaticMVPolynomial& other) const = default;
+
+  /**
+   * \brief Calculate the value at x by powers of each coordinate.
+   * \param[in] x a point which has operator[] (ex. std::array or CoordType).
+   */
+  template <class Coord>
+  friend constexpr R Of(const StaticMVPolynomial& p, const Coord& x) {
+    auto sum = R(0);
+    for (std::size_t k = 0; k != N; ++k) {
+      auto monomial = p.coefficients[k];
+      for (int axis = 0; axis != dim; ++axis) {
+        monomial *= Pow(static_cast<R>(x[axis]), p.indexes[k][axis]);
+      }
+      sum += monomial;
+    }
+    return sum;
+  }
+
+  /**
+   * \brief Integrate p along the axis, which keeps the number of terms.
+   */
+  friend constexpr StaticMVPolynomial Integrate(StaticMVPolynomial p, std::size_t axis) {
+    CheckAxis(axis);
+    for (std::size_t k = 0; k != N; ++k) {
+      p.coefficients[k] /= ++p.indexes[k][axis];
+    }
+    return p;
+  }
+
+  static constexpr void CheckAxis(std::size_t axis) {
+    if (axis >= static_cast<std::size_t>(dim)) {
+      throw std::runtime_error(
+          fmt::format("StaticMVPolynomial: Given axis {} must be in [0, {}).", axis, dim)
+      );
+    }
+  }
+
+  std::array<index_type, N> indexes{};
+  std::array<R, N>          coefficients{};
+
+ private:
+  // A throw in a constant expression is a compile error.
+  constexpr void Check() const {
+    for (std::size_t k = 0; k != N; ++k) {
+      for (int axis = 0; axis != dim; ++axis) {
+        if (indexes[k][axis] < 0) {
+          throw std::runtime_error("StaticMVPolynomial: An index has a negative element.");
+        }
+      }
+      if (k != 0 && indexes[k - 1] == indexes[k]) {
+        throw std::runtime_error("StaticMVPolynomial: An index appears more than once.");
+      }
+    }
+  }
+};
+
+namespace detail {
+template <auto P>
+using StaticPolynomialType = std::remove_cvref_t<decltype(P)>;
+
+/**
+ * \brief Sorted products of the terms of L and R whose equal indexes are summed up.
+ */
+template <class Index, class Scalar, std::size_t N>
+struct StaticTerms {
+  std::array<Index, N>  indexes{};
+  std::array<Scalar, N> coefficients{};
+  std::size_t           size = 0;
+};
+
+template <auto L, auto R>
+constexpr auto StaticProductTerms() {
+  using P      = StaticPolynomialType<L>;
+  using Scalar = typename P::mapped_type;
+  using Index  = typename P::index_type;
+
+  constexpr auto n_products = P::size() * StaticPolynomialType<R>::size();
+
+  auto products = std::array<std::pair<Index, Scalar>, n_products>();
+  auto k        = std::size_t(0);
+  for (std::size_t i = 0; i != P::size(); ++i) {
+    for (std::size_t j = 0; j != R.size(); ++j) {
+      for (int axis = 0; axis != P::dim; ++axis) {
+        products[k].first[axis] = L.indexes[i][axis] + R.indexes[j][axis];
+      }
+      products[k++].second = L.coefficients[i] * R.coefficients[j];
+    }
+  }
+  // Sort by positions as well, so that equal indexes are summed up in order of the terms of L.
+  auto order = std::array<std::size_t, n_products>();
+  for (std::size_t i = 0; i != n_products; ++i) {
+    order[i] = i;
+  }
+  std::sort(order.begin(), order.end(), [&products](std::size_t l, std::size_t r) {
+    return products[l].first > products[r].first ||
+           (products[l].first == products[r].first && l < r);
+  });
+
+  auto terms = StaticTerms<Index, Scalar, n_products>();
+  for (auto i : order) {
+    const auto& [index, value] = products[i];
+    if (terms.size != 0 && terms.indexes[terms.size - 1] == index) {
+      terms.coefficients[terms.size - 1] += value;
+    } else {
+      terms.indexes[terms.size]        = index;
+      terms.coefficients[terms.size++] = value;
+    }
+  }
+  return terms;
+}
+
+/**
+ * \brief Return the offset of the powers of each axis in the table of Of<P>, and its size last.
+ */
+template <auto P>
+constexpr auto StaticPowerOffsets() {
+  using Polynomial = StaticPolynomialType<P>;
+
+  const auto degrees = P.degrees();
+  auto       offsets = std::array<std::size_t, Polynomial::dim + 1>();
+  for (int axis = 0; axis != Polynomial::dim; ++axis) {
+    offsets[axis + 1] = offsets[axis] + static_cast<std::size_t>(degrees[axis]) + 1;
+  }
+  return offsets;
+}
+
+/**
+ * \brief Tabulate the powers of x[Axis] from 0 to the degree of Axis.
+ */
+template <auto P, std::size_t Axis, class Table, class Coord, std::size_t... Exponents>
+constexpr void StaticPowers(Table& powers, const Coord& x, std::index_sequence<Exponents...>) {
+  using Scalar = typename Table::value_type;
+
+  constexpr auto offset = StaticPowerOffsets<P>()[Axis];
+  powers[offset]        = Scalar(1);
+  ((powers[offset + Exponents + 1] = powers[offset + Exponents] * static_cast<Scalar>(x[Axis])),
+   ...);
+}
+
+template <auto P, class Table, class Coord, std::size_t... Axes>
+constexpr void StaticPowerTable(Table& powers, const Coord& x, std::index_sequence<Axes...>) {
+  (StaticPowers<P, Axes>(powers, x, std::make_index_sequence<P.degrees()[Axes]>()), ...);
+}
+
+/**
+ * \brief Return the power of the Axis-th element of the K-th index of P.
+ * \details The exponents are constants, so the factors whose exponent is 0 are 1 at compile time.
+ */
+template <auto P, std::size_t K, std::size_t Axis, class Table>
+constexpr auto StaticFactor(const Table& powers) {
+  using Scalar = typename Table::value_type;
+
+  if constexpr (P.indexes[K][Axis] == 0) {
+    return Scalar(1);
+  } else {
+    return powers[StaticPowerOffsets<P>()[Axis] + P.indexes[K][Axis]];
+  }
+}
+
+template <auto P, std::size_t K, class Table, std::size_t... Axes>
+constexpr auto StaticMonomial(const Table& powers, std::index_sequence<Axes...>) {
+  return (P.coefficients[K] * ... * StaticFactor<P, K, Axes>(powers));
+}
+
+template <auto P, class Table, std::size_t... K>
+constexpr auto StaticSum(const Table& powers, std::index_sequence<K...>) {
+  using Scalar = typename Table::value_type;
+  using Axes   = std::make_index_sequence<StaticPolynomialType<P>::dim>;
+
+  return (Scalar(0) + ... + StaticMonomial<P, K>(powers, Axes()));
+}
+}  // namespace detail
+
+/**
+ * \brief Calculate the value at x of a polynomial given as a template argument.
+ * \details The powers of each coordinate up to the degrees of P are tabulated and the terms are
+ * summed up by fold expressions, so the evaluation is straight-line code without loops.
+ * \tparam P a StaticMVPolynomial.
+ * \param[in] x a point which has operator[] (ex. std::array or CoordType).
+ */
+template <auto P, class Coord>
+constexpr auto Of(const Coord& x) {
+  using Polynomial = detail::StaticPolynomialType<P>;
+  using Scalar     = typename Polynomial::mapped_type;
+
+  constexpr auto dim = Polynomial::dim;
+
+  auto powers = std::array<Scalar, detail::StaticPowerOffsets<P>()[dim]>();
+  detail::StaticPowerTable<P>(powers, x, std::make_index_sequence<dim>());
+  return detail::StaticSum<P>(powers, std::make_index_sequence<Polynomial::size()>());
+}
+
+/**
+ * \brief Differentiate a polynomial given as a template argument along Axis.
+ * \details The terms whose degree of Axis is 0 vanish, so the number of terms of the result is
+ * counted at compile time.
+ */
+template <auto P, int Axis>
+constexpr auto D() {
+  using Polynomial = detail::StaticPolynomialType<P>;
+  static_assert(0 <= Axis && Axis < Polynomial::dim, "D: Axis is out of range.");
+
+  constexpr auto n_terms = [] {
+    auto n = std::size_t(0);
+    for (const auto& index : P.indexes) {
+      n += index[Axis] != 0;
+    }
+    return n;
+  }();
+
+  using Result = typename Polynomial::template rebind<n_terms>;
+  auto indexes = std::array<typename Result::index_type, n_terms>();
+  auto coeffs  = std::array<typename Result::mapped_type, n_terms>();
+  auto k       = std::size_t(0);
+  for (std::size_t i = 0; i != Polynomial::size(); ++i) {
+    if (P.indexes[i][Axis] != 0) {
+      indexes[k] = P.indexes[i];
+      coeffs[k]  = P.coefficients[i] * indexes[k][Axis]--;
+      ++k;
+    }
+  }
+  return Result(indexes, coeffs);
+}
+
+/**
+ * \brief Multiply polynomials given as template arguments.
+ * \details The products of equal indexes are summed up in order of the terms of L, and the number
+ * of terms of the result is counted at compile time. Terms whose coefficients cancel are kept.
+ */
+template <auto L, auto R>
+constexpr auto Product() {
+  using Polynomial = detail::StaticPolynomialType<L>;
+  static_assert(
+      std::is_same_v<
+          typename Polynomial::template rebind<0>,
+          typename detail::StaticPolynomialType<R>::template rebind<0>>,
+      "Product: the polynomials must have the same types of indexes and coefficients."
+  );
+
+  constexpr auto terms = detail::StaticProductTerms<L, R>();
+
+  using Result = typename Polynomial::template rebind<terms.size>;
+  auto indexes = std::array<typename Result::index_type, terms.size>();
+  auto coeffs  = std::array<typename Result::mapped_type, terms.size>();
+  std::copy_n(terms.indexes.begin(), terms.size, indexes.begin());
+  std::copy_n(terms.coefficients.begin(), terms.size, coeffs.begin());
+  return Result(indexes, coeffs);
+}
+}  // namespace mvPolynomial
+
+#endif
@@ -0,0 +1,197 @@
+#ifndef _MVPOLYNOMIAL_SUM_HPP_
+#define _MVPOLYNOMIAL_SUM_HPP_
+
+#include "mvPolynomial/validation.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace mvPolynomial {
+namespace detail {
+/**
+ * \brief Merge the terms of polynomials scaled by coefficients with a heap into seq.
+ * \details The heap holds the next term of each polynomial. The terms which have the same index
+ * are summed in order of the polynomials, so the result is bit-identical to adding them one by
+ * one with operator+.
+ * \param[in] polynomials pointers to polynomials.
+ * \param[in] coeff coeff(k) returns the coefficient of the k-th polynomial.
+ * \param[in] comp the comparer of indexes.
+ * \param[out] seq a sequence where the result is appended.
+ */
+template <class P, class Allocator, class Coeff, class Compare, class Sequence>
+void MergeSum(
+    const std::vector<const P*, Allocator>& polynomials, Coeff coeff, Compare comp, Sequence& seq
+) {
+  using const_iterator = typename P::const_iterator;
+
+  struct Entry {
+    const_iterator it;
+    const_iterator end;
+    std::size_t    k;
+  };
+
+  // std::push_heap keeps the greatest entry at the front, so an entry which comes later is less.
+  auto later = [&comp](const Entry& a, const Entry& b) {
+    if (comp(b.it->first, a.it->first)) {
+      return true;
+    }
+    if (comp(a.it->first, b.it->first)) {
+      return false;
+    }
+    return b.k < a.k;
+  };
+
+  using EntryAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>;
+
+  auto total = std::size_t(0);
+  auto heap  = std::vector<Entry, EntryAllocator>(polynomials.get_allocator());
+  heap.reserve(polynomials.size());
+  for (std::size_t k = 0; k != polynomials.size(); ++k) {
+    const auto& p = *polynomials[k];
+    total += p.size();
+    if (p.begin() != p.end()) {
+      heap.push_back(Entry{p.begin(), p.end(), k});
+    }
+  }
+  std::make_heap(heap.begin(), heap.end(), later);
+  seq.reserve(seq.size() + total);
+
+  auto pop = [&]() {
+    std::pop_heap(heap.begin(), heap.end(), later);
+    auto entry = heap.back();
+    heap.pop_back();
+    if (std::next(entry.it) != entry.end) {
+      heap.push_back(Entry{std::next(entry.it), entry.end, entry.k});
+      std::push_heap(heap.begin(), heap.end(), later);
+    }
+    return entry;
+  };
+
+  while (!heap.empty()) {
+    auto entry = pop();
+    auto sum   = coeff(entry.k) * entry.it->second;
+    while (!heap.empty() && !comp(entry.it->first, heap.front().it->first)) {
+      auto next = pop();
+      sum += coeff(next.k) * next.it->second;
+    }
+    seq.emplace_back(entry.it->first, sum);
+  }
+}
+
+template <class P>
+using PointerVector = std::vector<
+    const P*,
+    typename std::allocator_traits<typename P::allocator_type>::template rebind_alloc<const P*>>;
+
+/**
+ * \brief Collect pointers to polynomials into a vector allocated by the allocator of them.
+ */
+template <class P, class Range>
+PointerVector<P> Pointers(const Range& polynomials, const typename P::allocator_type& allocator) {
+  auto pointers = PointerVector<P>(allocator);
+  for (const auto& p : polynomials) {
+    pointers.push_back(&p);
+  }
+  return pointers;
+}
+}  // namespace detail
+
+/**
+ * \brief Sum up polynomials (ex. MVPolynomial, Polynomial) by one K-way merge.
+ * \details Unlike adding them one by one, no intermediate polynomial is made, and the output is
+ * allocated once for the total number of terms.
+ * \param[in] polynomials a range of polynomials which have the same comparer. If it is empty, the
+ * sum is a zero, P().
+ */
+template <std::ranges::forward_range Range>
+auto Sum(const Range& polynomials) {
+  using P = std::ranges::range_value_t<Range>;
+
+  if (std::ranges::empty(polynomials)) {
+    return P();
+  }
+  const auto& first = *std::ranges::begin(polynomials);
+  auto        seq   = typename P::sequence_type(first.get_allocator());
+  detail::MergeSum(
+      detail::Pointers<P>(polynomials, first.get_allocator()),
+      [](std::size_t) { return typename P::mapped_type(1); },
+      first.key_comp(),
+      seq
+  );
+  auto sum = P(first.key_comp(), first.get_allocator());
+  sum.adopt_sequence(ordered_unique_valid_range, std::move(seq));
+  return sum;
+}
+
+/**
+ * \brief Calculate a linear combination of polynomials, sum of coeffs[k] * polynomials[k].
+ * \param[in] polynomials a range of polynomials which have the same comparer. If it is empty, the
+ * sum is a zero, P().
+ * \param[in] coeffs a range of coefficients which has the same size as polynomials.
+ */
+template <std::ranges::forward_range Range, std::ranges::random_access_range Coeffs>
+auto Sum(const Range& polynomials, const Coeffs& coeffs) {
+  using P = std::ranges::range_value_t<Range>;
+
+  if (std::ranges::empty(polynomials)) {
+    return P();
+  }
+  const auto& first = *std::ranges::begin(polynomials);
+  auto        seq   = typename P::sequence_type(first.get_allocator());
+  detail::MergeSum(
+      detail::Pointers<P>(polynomials, first.get_allocator()),
+      [&coeffs](std::size_t k) {
+        return static_cast<typename P::mapped_type>(std::ranges::begin(coeffs)[k]);
+      },
+      first.key_comp(),
+      seq
+  );
+  auto sum = P(first.key_comp(), first.get_allocator());
+  sum.adopt_sequence(ordered_unique_valid_range, std::move(seq));
+  return sum;
+}
+
+/**
+ * \brief Add polynomials to out by one K-way merge of out and them.
+ */
+template <class P, std::ranges::forward_range Range>
+void AccumulateInto(P& out, const Range& polynomials) {
+  auto pointers = detail::Pointers<P>(polynomials, out.get_allocator());
+  pointers.insert(pointers.begin(), &out);
+
+  auto seq = typename P::sequence_type(out.get_allocator());
+  detail::MergeSum(
+      pointers, [](std::size_t) { return typename P::mapped_type(1); }, out.key_comp(), seq
+  );
+  out.adopt_sequence(ordered_unique_valid_range, std::move(seq));
+}
+
+/**
+ * \brief Add sum of coeffs[k] * polynomials[k] to out by one K-way merge.
+ */
+template <class P, std::ranges::forward_range Range, std::ranges::random_access_range Coeffs>
+void AccumulateInto(P& out, const Range& polynomials, const Coeffs& coeffs) {
+  auto pointers = detail::Pointers<P>(polynomials, out.get_allocator());
+  pointers.insert(pointers.begin(), &out);
+
+  auto seq = typename P::sequence_type(out.get_allocator());
+  detail::MergeSum(
+      pointers,
+      [&coeffs](std::size_t k) {
+        // out itself isn't scaled.
+        return k == 0 ? typename P::mapped_type(1)
+                      : static_cast<typename P::mapped_type>(std::ranges::begin(coeffs)[k - 1]);
+      },
+      out.key_comp(),
+      seq
+  );
+  out.adopt_sequence(ordered_unique_valid_range, std::move(seq));
+}
+}  // namespace mvPolynomial
+
+#endif
@@ -0,0 +1,165 @@
+#ifndef _MVPOLYNOMIAL_SUPPORT_HPP_
+#define _MVPOLYNOMIAL_SUPPORT_HPP_
+
+#include "mvPolynomial/mvPolynomial.hpp"
+#include "mvPolynomial/validation.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace mvPolynomial {
+/**
+ * \brief An immutable set of the indexes of a polynomial in order of its comparer.
+ * \details A polynomial is split into a support and a span of coefficients in the same order, so
+ * the coefficients can be updated without rebuilding anything that depends only on the indexes.
+ * It is never modified after construction, so it can be shared by threads (see MakeSupport).
+ * \tparam Polynomial MVPolynomial.
+ */
+template <class Polynomial>
+class Support {
+ public:
+  using polynomial_type = Polynomial;
+  using index_type      = typename polynomial_type::index_type;
+  using mapped_type     = typename polynomial_type::mapped_type;
+  using coord_type      = typename polynomial_type::coord_type;
+  using key_compare     = typename polynomial_type::key_compare;
+  using allocator_type  = typename polynomial_type::allocator_type;
+  using size_type       = typename polynomial_type::size_type;
+
+  static constexpr int dim = polynomial_type::dim;
+
+  using index_vector_type = std::vector<
+      index_type,
+      typename std::allocator_traits<allocator_type>::template rebind_alloc<index_type>>;
+
+  /**
+   * \brief Record the indexes of p.
+   */
+  explicit Support(const polynomial_type& p)
+      : indexes_(p.get_allocator()),
+        degrees_(p.degrees()),
+        comparer_(p.key_comp()),
+        allocator_(p.get_allocator()) {
+    indexes_.reserve(p.size());
+    for (const auto& index_and_value : p) {
+      indexes_.push_back(index_and_value.first);
+    }
+  }
+
+  Support(const Support& other)            = default;
+  Support& operator=(const Support& other) = default;
+  Support(Support&& other)                 = default;
+  Support& operator=(Support&& other)      = default;
+  virtual ~Support()                       = default;
+
+  size_type size() const noexcept { return indexes_.size(); }
+
+  bool empty() const noexcept { return indexes_.empty(); }
+
+  std::span<const index_type> indexes() const noexcept { return indexes_; }
+
+  const index_type& degrees() const noexcept { return degrees_; }
+
+  key_compare key_comp() const { return comparer_; }
+
+  allocator_type get_allocator() const noexcept { return allocator_; }
+
+  /**
+   * \brief Return true if p has the same indexes.
+   */
+  bool has_same_indexes(const polynomial_type& p) const {
+    return std::equal(
+        indexes_.begin(),
+        indexes_.end(),
+        p.begin(),
+        p.end(),
+        [](const index_type& l, const typename polynomial_type::value_type& r) {
+          return (l == r.first).all();
+        }
+    );
+  }
+
+ private:
+  index_vector_type indexes_;
+  index_type        degrees_;
+  key_compare       comparer_;
+  allocator_type    allocator_;
+};
+
+/**
+ * \brief Make a support of p which threads can share.
+ */
+template <class Polynomial>
+std::shared_ptr<const Support<Polynomial>> MakeSupport(const Polynomial& p) {
+  return std::allocate_shared<Support<Polynomial>>(p.get_allocator(), p);
+}
+
+/**
+ * \brief Return the coefficients of p in order of its terms.
+ */
+template <class Polynomial>
+auto Coefficients(const Polynomial& p) {
+  using Scalar = typename Polynomial::mapped_type;
+  using Alloc  = typename std::allocator_traits<
+      typename Polynomial::allocator_type>::template rebind_alloc<Scalar>;
+
+  auto coeffs = std::vector<Scalar, Alloc>(p.get_allocator());
+  coeffs.reserve(p.size());
+  for (const auto& index_and_value : p) {
+    coeffs.push_back(index_and_value.second);
+  }
+  return coeffs;
+}
+
+/**
+ * \brief Make a polynomial from a support and its coefficients.
+ */
+template <class Polynomial>
+Polynomial ToPolynomial(
+    const Support<Polynomial>& support, std::span<const typename Polynomial::mapped_type> coeffs
+) {
+  CheckCoefficientSize(support.size(), coeffs.size());
+
+  auto seq = typename Polynomial::sequence_type(support.get_allocator());
+  seq.reserve(support.size());
+  for (std::size_t k = 0; k != support.size(); ++k) {
+    seq.emplace_back(support.indexes()[k], coeffs[k]);
+  }
+  auto p = Polynomial(support.key_comp(), support.get_allocator());
+  p.adopt_sequence(ordered_unique_valid_range, std::move(seq));
+  return p;
+}
+
+/**
+ * \brief Calculate the value at x of the polynomial made from a support and its coefficients.
+ * \details The powers of each coordinate are tabulated up to the degrees of the support, so no
+ * polynomial is made.
+ */
+template <class Polynomial>
+auto Of(
+    const Support<Polynomial>&                        support,
+    std::span<const typename Polynomial::mapped_type> coeffs,
+    const typename Polynomial::coord_type&            x
+) {
+  CheckCoefficientSize(support.size(), coeffs.size());
+
+  const auto [offsets, powers] = MakePowerTables(support, x);
+
+  typename Polynomial::mapped_type sum = 0;
+  for (std::size_t k = 0; k != support.size(); ++k) {
+    const auto& index    = support.indexes()[k];
+    auto        monomial = coeffs[k];
+    for (int axis = 0; axis != Polynomial::dim; ++axis) {
+      monomial *= powers[offsets[axis] + index[axis]];
+    }
+    sum += monomial;
+  }
+  return sum;
+}
+}  // namespace mvPolynomial
+
+#endif
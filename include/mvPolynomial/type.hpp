@@ -11,6 +11,15 @@ using IndexType = Eigen::Array<IntType, D, 1>;
 
 template <std::floating_point R, int D>
 using CoordType = Eigen::Array<R, D, 1>;
+
+template <std::floating_point R, int D>
+using CoordArrayType = Eigen::Array<R, D, Eigen::Dynamic>;
+
+template <std::floating_point R, int D>
+using HessianType = Eigen::Matrix<R, D, D>;
+
+template <std::floating_point R>
+using ValueArrayType = Eigen::Array<R, 1, Eigen::Dynamic>;
 }  // namespace mvPolynomial
 
 #endif
@@ -0,0 +1,54 @@
+#ifndef _MVPOLYNOMIAL_VALIDATION_HPP_
+#define _MVPOLYNOMIAL_VALIDATION_HPP_
+
+#include <atomic>
+#include <concepts>
+
+#include "boost/container/container_fwd.hpp"
+
+namespace mvPolynomial {
+/**
+ * \brief A tag of a range which is ordered, unique and has only non-negative indexes.
+ * \details The constructors and adopt_sequence don't validate the indexes of such a range, so it
+ * is used by the functions which make indexes from valid polynomials (ex. operator*, D). It is an
+ * ordered_unique_range_t, so it can be passed where the base tag is expected.
+ */
+struct ordered_unique_valid_range_t : boost::container::ordered_unique_range_t {};
+
+inline constexpr ordered_unique_valid_range_t ordered_unique_valid_range{};
+
+/**
+ * \brief A concept of validation policies of polynomials.
+ */
+template <class V>
+concept ValidationPolicy = requires {
+  { V::validates } -> std::convertible_to<bool>;
+};
+
+/**
+ * \brief A validation policy which checks that each element of given indexes is non-negative.
+ */
+struct ValidateIndexes {
+  static constexpr bool validates = true;
+};
+
+/**
+ * \brief A validation policy which trusts all given indexes, for polynomials whose indexes are
+ * made only by trusted code.
+ */
+struct TrustIndexes {
+  static constexpr bool validates = false;
+};
+
+namespace detail {
+/**
+ * \brief Order the accesses to the sequence of a flat_map around its adoption or extraction.
+ * \details boost::container::flat_map casts between vectors of std::pair and of its own pair to
+ * adopt or extract its sequence, so with strict aliasing the compiler may read the vector before
+ * it is written (ex. an empty product after adopt_sequence). The fence keeps the order.
+ */
+inline void SequenceFence() noexcept { std::atomic_signal_fence(std::memory_order_seq_cst); }
+}  // namespace detail
+}  // namespace mvPolynomial
+
+#endif
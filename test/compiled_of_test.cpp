@@ -0,0 +1,98 @@
+#define BOOST_TEST_MODULE compiled_of_unit_test
+
+#include "boost/test/unit_test.hpp"
+#include "mvPolynomial/compiled_of.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace utf = boost::unit_test;
+namespace tt  = boost::test_tools;
+
+using MP2 = mvPolynomial::MVPolynomial<int, double, 2>;
+using MP4 = mvPolynomial::MVPolynomial<int, double, 4>;
+
+using CO2 = mvPolynomial::CompiledOf<int, double, 2>;
+using CO4 = mvPolynomial::CompiledOf<int, double, 4>;
+
+BOOST_AUTO_TEST_CASE(compiled_of_init, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  auto ans = std::vector<std::pair<Eigen::Array2i, double>>();
+  ans      = {
+      {{0, 0}, 1},
+      {{1, 0}, 2},
+      {{0, 1}, 3},
+      {{1, 1}, 4},
+      {{2, 0}, 5},
+      {{0, 2}, 6},
+  };
+
+  auto m           = MP2(ans.begin(), ans.end());
+  auto compiled_of = CO2(m);
+  BOOST_TEST(compiled_of.get_tape().size() == m.size());
+  BOOST_TEST(compiled_of(Eigen::Vector2d::Zero()) == 1);
+  BOOST_TEST(compiled_of({2, 3}) == 112);
+
+  m.clear();
+  compiled_of.set_polynomial(m);
+  BOOST_TEST(compiled_of({2, 3}) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(compiled_of_many_terms, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  auto m = MP4();
+  for (int i = 0; i != 6; ++i) {
+    for (int j = 0; j != 6 - i; ++j) {
+      for (int k = 0; k != 5; ++k) {
+        for (int l = 0; l != 4; l += 1 + (i + k) % 2) {
+          m[{i, j, k, l}] = 1.0 / (1 + i + 2 * j) - 0.25 * k + 0.125 * l;
+        }
+      }
+    }
+  }
+  auto compiled_of = CO4(m);
+  auto xs          = std::vector<MP4::coord_type>{
+      { 0,    0,   0,    0},
+      { 1,    1,   1,    1},
+      {-1,  0.5,   2, -0.5},
+      {0.3, -1.2, 0.7,  1.1},
+  };
+  for (const auto& x : xs) {
+    BOOST_TEST(compiled_of(x) == Of(m, x));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(compiled_of_const, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  // The tables of powers have more than 64 elements.
+  auto m = MP2();
+  for (int i = 0; i <= 40; ++i) {
+    m[{i, 40 - i}] = 1.0 / (1 + i);
+  }
+  const auto compiled_of = CO2(m);
+
+  // Each thread has its own workspace and shares compiled_of.
+  const auto n_threads = 4;
+  const auto n_points  = 64;
+  auto       values    = std::vector<double>(n_threads * n_points);
+  auto       threads   = std::vector<std::thread>();
+  for (auto t = 0; t != n_threads; ++t) {
+    threads.emplace_back([&compiled_of, &values, t]() {
+      auto workspace = compiled_of.make_workspace();
+      for (auto k = 0; k != n_points; ++k) {
+        const auto x = MP2::coord_type(0.01 * k - 0.3, 0.9 - 0.1 * t);
+        values[t * n_points + k] = compiled_of(x, workspace);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (auto t = 0; t != n_threads; ++t) {
+    for (auto k = 0; k != n_points; ++k) {
+      const auto x = MP2::coord_type(0.01 * k - 0.3, 0.9 - 0.1 * t);
+      BOOST_TEST(values[t * n_points + k] == Of(m, x));
+    }
+  }
+
+  // A default CompiledOf is zero.
+  auto empty = CO2();
+  BOOST_TEST(empty({2, 3}) == 0);
+}
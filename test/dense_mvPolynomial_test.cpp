@@ -0,0 +1,133 @@
+#define BOOST_TEST_MODULE dense_mvPolynomial_unit_test
+
+#include "boost/test/unit_test.hpp"
+#include "mvPolynomial/dense_mvPolynomial.hpp"
+#include "mvPolynomial/mvPolynomial.hpp"
+
+#include <random>
+#include <vector>
+
+namespace utf = boost::unit_test;
+namespace tt  = boost::test_tools;
+
+using MP2    = mvPolynomial::MVPolynomial<int, double, 2>;
+using MP3    = mvPolynomial::MVPolynomial<int, double, 3>;
+using Dense2 = mvPolynomial::DenseMVPolynomial<int, double, 2>;
+using Dense3 = mvPolynomial::DenseMVPolynomial<int, double, 3>;
+
+MP3 RandomMP3(std::mt19937& engine, int degree) {
+  auto dist = std::uniform_int_distribution<int>(1, 9);
+  auto p    = MP3();
+  for (auto i = 0; i <= degree; ++i) {
+    for (auto j = 0; j <= degree; ++j) {
+      for (auto k = 0; k <= degree; ++k) {
+        p[{i, j, k}] = dist(engine);
+      }
+    }
+  }
+  return p;
+}
+
+BOOST_AUTO_TEST_CASE(dense_mvPolynomial_init, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  auto mp = MP2({
+      {{0, 0}, 1},
+      {{1, 0}, 2},
+      {{0, 2}, 3},
+  });
+  auto p  = Dense2(mp);
+  BOOST_TEST((p.degrees() == Eigen::Array2i(1, 2)).all());
+  BOOST_TEST(p.size() == 6);
+  BOOST_TEST(p.at({0, 0}) == 1);
+  BOOST_TEST(p.at({1, 0}) == 2);
+  BOOST_TEST(p.at({0, 2}) == 3);
+  BOOST_TEST(p.at({1, 1}) == 0);
+  BOOST_TEST(p.density() == 0.5);
+  BOOST_CHECK_THROW(p.at({2, 0}), std::out_of_range);
+
+  auto back = p.ToMVPolynomial();
+  BOOST_TEST(back.size() == mp.size());
+  auto it = mp.begin();
+  for (const auto& [index, value] : back) {
+    BOOST_TEST((index == it->first).all());
+    BOOST_TEST(value == it->second);
+    ++it;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(dense_mvPolynomial_Of, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  auto engine = std::mt19937(0);
+  auto mp     = RandomMP3(engine, 3);
+  auto p      = Dense3(mp);
+  BOOST_TEST(Of(p, {0.5, -1.5, 2.0}) == Of(mp, {0.5, -1.5, 2.0}));
+
+  auto dx  = D(p, 0);
+  auto dmp = D(mp, 0);
+  BOOST_TEST(Of(dx, {0.5, -1.5, 2.0}) == Of(dmp, {0.5, -1.5, 2.0}));
+  auto dz = D(p, 2);
+  BOOST_TEST(Of(dz, {0.5, -1.5, 2.0}) == Of(D(mp, 2), {0.5, -1.5, 2.0}));
+}
+
+BOOST_AUTO_TEST_CASE(dense_mvPolynomial_sum, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  auto l = Dense2(MP2({
+      {{0, 0}, 1},
+      {{2, 0}, 2},
+  }));
+  auto r = Dense2(MP2({
+      {{0, 0}, 3},
+      {{0, 3}, 4},
+  }));
+
+  auto sum = l + r;
+  BOOST_TEST((sum.degrees() == Eigen::Array2i(2, 3)).all());
+  BOOST_TEST(sum.at({0, 0}) == 4);
+  BOOST_TEST(sum.at({2, 0}) == 2);
+  BOOST_TEST(sum.at({0, 3}) == 4);
+
+  auto sub = l - r;
+  BOOST_TEST(sub.at({0, 0}) == -2);
+  BOOST_TEST(sub.at({0, 3}) == -4);
+}
+
+BOOST_AUTO_TEST_CASE(
+    dense_mvPolynomial_multiply, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  auto engine = std::mt19937(1);
+  // The Kronecker substituted sequences are long enough to use Karatsuba's method.
+  for (auto [l_degree, r_degree] : {std::pair(1, 2), std::pair(4, 4), std::pair(5, 2)}) {
+    auto l_mp = RandomMP3(engine, l_degree);
+    auto r_mp = RandomMP3(engine, r_degree);
+    auto ans  = l_mp * r_mp;
+    auto prod = (Dense3(l_mp) * Dense3(r_mp)).ToMVPolynomial();
+    BOOST_TEST(prod.size() == ans.size());
+    for (const auto& [index, value] : ans) {
+      BOOST_TEST(prod.at(index) == value);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(convolve, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  auto engine = std::mt19937(2);
+  auto dist   = std::uniform_real_distribution<double>(-1, 1);
+  const auto lengths = {std::pair(3, 5), std::pair(40, 40), std::pair(33, 100), std::pair(77, 64)};
+  for (auto [na, nb] : lengths) {
+    auto a = std::vector<double>(na);
+    auto b = std::vector<double>(nb);
+    for (auto& v : a) {
+      v = dist(engine);
+    }
+    for (auto& v : b) {
+      v = dist(engine);
+    }
+    auto ans = std::vector<double>(na + nb - 1);
+    for (auto i = 0; i != na; ++i) {
+      for (auto j = 0; j != nb; ++j) {
+        ans[i + j] += a[i] * b[j];
+      }
+    }
+    auto out = std::vector<double>(na + nb - 1);
+    mvPolynomial::Convolve(a.data(), a.size(), b.data(), b.size(), out.data());
+    for (std::size_t i = 0; i != out.size(); ++i) {
+      BOOST_TEST(out[i] == ans[i], tt::tolerance(1e-10));
+    }
+  }
+}
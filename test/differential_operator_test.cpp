@@ -0,0 +1,117 @@
+#define BOOST_TEST_MODULE differential_operator_unit_test
+
+#include "boost/test/unit_test.hpp"
+#include "mvPolynomial/differential_operator.hpp"
+#include "mvPolynomial/mvPolynomial.hpp"
+#include "mvPolynomial/polynomial.hpp"
+
+#include <stdexcept>
+
+namespace utf = boost::unit_test;
+namespace tt  = boost::test_tools;
+
+using MP3  = mvPolynomial::DefaultMVPolynomial<int, double, 3>;
+using Poly = mvPolynomial::DefaultPolynomial<int, double>;
+
+// An order of indexes under which D and Integrate change the order of terms.
+struct SumComparer {
+  bool operator()(const Eigen::Array3i& l, const Eigen::Array3i& r) const {
+    const auto l_sum = l.sum();
+    const auto r_sum = r.sum();
+    return l_sum < r_sum || (l_sum == r_sum && (l[0] < r[0] || (l[0] == r[0] && l[1] < r[1])));
+  }
+};
+
+using SumMP3 = mvPolynomial::MVPolynomial<int, double, 3, SumComparer>;
+
+template <class P>
+P MakeP(double scale) {
+  auto p = P();
+  for (auto i = 0; i != 4; ++i) {
+    for (auto j = 0; j != 3; ++j) {
+      p[{i, j, (i * j) % 3}] = scale * (1.0 + i - 0.5 * j);
+    }
+  }
+  return p;
+}
+
+template <class P>
+void CheckSame(const P& l, const P& r) {
+  BOOST_TEST(l.size() == r.size());
+  auto it = r.begin();
+  for (const auto& [index, value] : l) {
+    BOOST_TEST((index == it->first).all());
+    BOOST_TEST(value == it->second, tt::tolerance(1e-12));
+    ++it;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(differential_operator_same_as_D_and_Integrate) {
+  const auto p  = MakeP<MP3>(1.0);
+  const auto op = mvPolynomial::DifferentialOperator<MP3>(p);
+  BOOST_TEST(op.size() == p.size());
+  BOOST_TEST(op.has_same_support(p));
+
+  // The coefficients change, but the indexes don't.
+  const auto q = MakeP<MP3>(-2.5);
+  BOOST_TEST(op.has_same_support(q));
+  for (auto axis = 0; axis != 3; ++axis) {
+    CheckSame(op.differentiate(q, axis), D(q, axis));
+    CheckSame(op.integrate(q, axis), Integrate(q, axis));
+  }
+
+  // The output is reused.
+  auto out = MP3();
+  op.differentiate(p, 1, out);
+  CheckSame(out, D(p, 1));
+  op.integrate(q, 2, out);
+  CheckSame(out, Integrate(q, 2));
+}
+
+BOOST_AUTO_TEST_CASE(differential_operator_in_place) {
+  const auto p  = MakeP<MP3>(1.0);
+  const auto op = mvPolynomial::DifferentialOperator<MP3>(p);
+  for (auto axis = 0; axis != 3; ++axis) {
+    auto d = p;
+    op.differentiate(d, axis, d);
+    CheckSame(d, D(p, axis));
+
+    auto integral = p;
+    op.integrate(integral, axis, integral);
+    CheckSame(integral, Integrate(p, axis));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(differential_operator_reorder) {
+  const auto p  = MakeP<SumMP3>(0.5);
+  const auto op = mvPolynomial::DifferentialOperator<SumMP3>(p);
+  for (auto axis = 0; axis != 3; ++axis) {
+    CheckSame(op.differentiate(p, axis), D(p, axis));
+    CheckSame(op.integrate(p, axis), Integrate(p, axis));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(
+    differential_operator_polynomial, *utf::tolerance(tt::fpc::percent_tolerance(1e-12))
+) {
+  auto p = Poly();
+  for (auto i = 0; i != 6; i += 2) {
+    p[i] = 1.0 / (i + 1);
+  }
+  const auto op = mvPolynomial::DifferentialOperator<Poly>(p);
+  const auto d  = op.differentiate(p);
+  const auto i  = op.integrate(p);
+  BOOST_TEST(Of(d, 0.75) == Of(D(p), 0.75));
+  BOOST_TEST(Of(i, 0.75) == Of(Integrate(p), 0.75));
+}
+
+BOOST_AUTO_TEST_CASE(differential_operator_error) {
+  const auto p  = MakeP<MP3>(1.0);
+  const auto op = mvPolynomial::DifferentialOperator<MP3>(p);
+  BOOST_CHECK_THROW(op.differentiate(p, 3), std::runtime_error);
+
+  auto q = p;
+  q[{5, 5, 5}] = 1.0;
+  BOOST_TEST(!op.has_same_support(q));
+  BOOST_CHECK_THROW(op.integrate(q, 0), std::runtime_error);
+}
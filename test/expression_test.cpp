@@ -0,0 +1,114 @@
+#define BOOST_TEST_MODULE expression_unit_test
+
+#include "boost/test/unit_test.hpp"
+#include "mvPolynomial/expression.hpp"
+#include "mvPolynomial/mvPolynomial.hpp"
+#include "mvPolynomial/polynomial.hpp"
+
+#include <random>
+#include <vector>
+
+namespace utf = boost::unit_test;
+namespace tt  = boost::test_tools;
+
+using MP3  = mvPolynomial::MVPolynomial<int, double, 3>;
+using Poly = mvPolynomial::DefaultPolynomial<int, double>;
+
+using mvPolynomial::Lazy;
+
+MP3 RandomMP3(std::mt19937& engine, std::size_t n) {
+  auto dist  = std::uniform_int_distribution<int>(0, 4);
+  auto coeff = std::uniform_real_distribution<double>(-1, 1);
+  auto p     = MP3();
+  for (std::size_t i = 0; i != n; ++i) {
+    p[{dist(engine), dist(engine), dist(engine)}] = coeff(engine);
+  }
+  return p;
+}
+
+BOOST_AUTO_TEST_CASE(expression_evaluate, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  auto engine = std::mt19937(0);
+  auto a      = RandomMP3(engine, 10);
+  auto b      = RandomMP3(engine, 20);
+  auto c      = RandomMP3(engine, 15);
+  auto d      = RandomMP3(engine, 5);
+  auto e      = RandomMP3(engine, 30);
+
+  auto minus_e = e;
+  minus_e *= -1;
+  auto ans = a * b + c * d + minus_e;
+
+  MP3 result = Lazy(a) * b + Lazy(c) * d - e;
+  BOOST_TEST(result.size() == ans.size());
+  for (const auto& [index, value] : ans) {
+    BOOST_TEST(result.at(index) == value, tt::tolerance(1e-12));
+  }
+
+  // A product of three polynomials and a scaled sum.
+  auto ans2 = a * b * c;
+  ans2 *= 2;
+  ans2 = ans2 + d;
+  ans2 = ans2 + d;
+  auto result2 = mvPolynomial::Evaluate(2.0 * (Lazy(a) * b * c) + (Lazy(d) + d));
+  BOOST_TEST(result2.size() == ans2.size());
+  for (const auto& [index, value] : ans2) {
+    BOOST_TEST(result2.at(index) == value, tt::tolerance(1e-12));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(
+    expression_product_of_sums, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  auto engine = std::mt19937(2);
+  auto a      = RandomMP3(engine, 10);
+  auto b      = RandomMP3(engine, 20);
+  auto c      = RandomMP3(engine, 15);
+  auto d      = RandomMP3(engine, 5);
+  auto e      = RandomMP3(engine, 8);
+  auto f      = RandomMP3(engine, 12);
+
+  // The sums are evaluated before they are multiplied.
+  const auto ans    = (a + b) * (c - d) + e;
+  MP3        result = (Lazy(a) + b) * (Lazy(c) - d) + e;
+  BOOST_TEST(result.size() == ans.size());
+  for (const auto& [index, value] : ans) {
+    BOOST_TEST(result.at(index) == value, tt::tolerance(1e-12));
+  }
+
+  const auto ans2    = (a + b) * (c + d) * (e + f);
+  MP3        result2 = (Lazy(a) + b) * (Lazy(c) + d) * (Lazy(e) + f) * 2.0;
+  BOOST_TEST(result2.size() == ans2.size());
+  for (const auto& [index, value] : ans2) {
+    BOOST_TEST(result2.at(index) == 2 * value, tt::tolerance(1e-12));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(expression_Of, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  auto engine = std::mt19937(1);
+  auto a      = RandomMP3(engine, 10);
+  auto b      = RandomMP3(engine, 20);
+  auto c      = RandomMP3(engine, 15);
+
+  auto x    = MP3::coord_type(0.5, -1.5, 2.0);
+  auto expr = (Lazy(a) - b) * c * 3.0;
+  BOOST_TEST(Of(expr, x) == (Of(a, x) - Of(b, x)) * Of(c, x) * 3.0);
+  BOOST_TEST(Of(expr, x) == Of(mvPolynomial::Evaluate(expr), x));
+}
+
+BOOST_AUTO_TEST_CASE(expression_polynomial, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  auto a = Poly({
+      {0, 1},
+      {1, 2},
+  });
+  auto b = Poly({
+      {0, 3},
+      {2, 4},
+  });
+
+  Poly result = Lazy(a) * a - b;
+  BOOST_TEST(result.size() == 3);
+  BOOST_TEST(result.at(0) == -2);
+  BOOST_TEST(result.at(1) == 4);
+  BOOST_TEST(result.at(2) == 0);
+  BOOST_TEST(Of(-Lazy(b), 2.0) == -19);
+}
@@ -0,0 +1,117 @@
+#define BOOST_TEST_MODULE integration_unit_test
+
+#include "boost/test/unit_test.hpp"
+#include "mvPolynomial/integration.hpp"
+#include "mvPolynomial/mvPolynomial.hpp"
+#include "mvPolynomial/polynomial.hpp"
+#include "mvPolynomial/polynomial_product.hpp"
+
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+namespace utf = boost::unit_test;
+namespace tt  = boost::test_tools;
+
+using MP2  = mvPolynomial::MVPolynomial<int, double, 2>;
+using MP3  = mvPolynomial::MVPolynomial<int, double, 3>;
+using Poly = mvPolynomial::Polynomial<int, double>;
+using PP2  = mvPolynomial::PolynomialProduct<Poly, 2>;
+
+MP3 MakeMP3() {
+  return MP3({
+      {{0, 0, 0}, 1},
+      {{1, 0, 0}, -2},
+      {{0, 2, 1}, 3},
+      {{3, 1, 2}, 0.5},
+      {{2, 2, 2}, -1.5},
+  });
+}
+
+BOOST_AUTO_TEST_CASE(integration_box, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  const auto p  = MakeMP3();
+  const auto lo = MP3::coord_type(-0.5, 0.25, 1);
+  const auto hi = MP3::coord_type(1.5, 2, 1.75);
+
+  // Integrate along each axis and take the differences at the corners.
+  auto expected = 0.0;
+  for (auto corner = 0; corner != 8; ++corner) {
+    auto x    = MP3::coord_type();
+    auto sign = 1;
+    for (int axis = 0; axis != 3; ++axis) {
+      const auto upper = (corner >> axis) & 1;
+      x[axis]          = upper ? hi[axis] : lo[axis];
+      sign *= upper ? 1 : -1;
+    }
+    expected += sign * Of(Integrate(Integrate(Integrate(p, 0), 1), 2), x);
+  }
+  BOOST_TEST(IntegrateBox(p, lo, hi) == expected);
+
+  // A thin box doesn't lose digits by cancellation.
+  const auto q    = MP2({{{4, 0}, 1}});
+  const auto h    = std::ldexp(1.0, -30);
+  const auto thin = IntegrateBox(q, MP2::coord_type(1, 0), MP2::coord_type(1 + h, 1));
+  BOOST_TEST(thin == h * (1 + 2 * h + 2 * h * h), tt::tolerance(1e-14));
+}
+
+BOOST_AUTO_TEST_CASE(integration_simplex, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  // The integral of x^a y^b over the unit triangle is a! b! / (a + b + 2)!.
+  auto unit = mvPolynomial::CoordArrayType<double, 2>(2, 3);
+  unit << 0, 1, 0, 0, 0, 1;
+  BOOST_TEST(IntegrateSimplex(MP2({{{2, 3}, 1}}), unit) == 2.0 * 6 / 5040);
+
+  // Two triangles which split a box.
+  const auto p  = MP2({
+      {{0, 0}, 1},
+      {{1, 0}, -2},
+      {{2, 3}, 0.5},
+      {{0, 4}, 3},
+  });
+  const auto lo = MP2::coord_type(-0.5, 0.25);
+  const auto hi = MP2::coord_type(1.5, 2);
+  auto       lower = mvPolynomial::CoordArrayType<double, 2>(2, 3);
+  auto       upper = mvPolynomial::CoordArrayType<double, 2>(2, 3);
+  lower << lo[0], hi[0], hi[0], lo[1], lo[1], hi[1];
+  upper << hi[0], lo[0], lo[0], hi[1], hi[1], lo[1];
+  BOOST_TEST(IntegrateSimplex(p, lower) + IntegrateSimplex(p, upper) == IntegrateBox(p, lo, hi));
+
+  // Six tetrahedra which split a box along its diagonal.
+  const auto q   = MakeMP3();
+  const auto lo3 = MP3::coord_type(-0.5, 0.25, 1);
+  const auto hi3 = MP3::coord_type(1.5, 2, 1.75);
+  const auto permutations = std::array<std::array<int, 3>, 6>{
+      {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}}
+  };
+  auto sum = 0.0;
+  for (const auto& permutation : permutations) {
+    auto vertices = mvPolynomial::CoordArrayType<double, 3>(3, 4);
+    auto x        = lo3;
+    vertices.col(0) = x;
+    for (int k = 0; k != 3; ++k) {
+      x[permutation[k]]   = hi3[permutation[k]];
+      vertices.col(k + 1) = x;
+    }
+    sum += IntegrateSimplex(q, vertices);
+  }
+  BOOST_TEST(sum == IntegrateBox(q, lo3, hi3));
+
+  const auto segment = mvPolynomial::CoordArrayType<double, 2>(2, 2);
+  BOOST_CHECK_THROW(IntegrateSimplex(p, segment), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(
+    integration_polynomial_product, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  const auto pp = PP2({
+      Poly({{0, 1}, {1, 2}, {3, -3}}),
+      Poly({{0, 4}, {2, -5}}),
+  });
+  const auto p  = mvPolynomial::Expand(pp);
+  const auto lo = PP2::coord_type(-0.5, 0.25);
+  const auto hi = PP2::coord_type(1.5, 2);
+  BOOST_TEST(IntegrateBox(pp, lo, hi) == IntegrateBox(p, lo, hi));
+
+  auto vertices = mvPolynomial::CoordArrayType<double, 2>(2, 3);
+  vertices << 0.5, 2, -1, -0.25, 1, 1.5;
+  BOOST_TEST(IntegrateSimplex(pp, vertices) == IntegrateSimplex(p, vertices));
+}
@@ -0,0 +1,139 @@
+#define BOOST_TEST_MODULE multiplication_unit_test
+
+#include "boost/test/unit_test.hpp"
+#include "mvPolynomial/multiplication.hpp"
+#include "mvPolynomial/mvPolynomial.hpp"
+#include "mvPolynomial/polynomial.hpp"
+
+#include <functional>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace utf = boost::unit_test;
+namespace tt  = boost::test_tools;
+
+using MP3 = mvPolynomial::MVPolynomial<int, double, 3>;
+using P   = mvPolynomial::DefaultPolynomial<int, double>;
+
+BOOST_AUTO_TEST_CASE(heap_multiply) {
+  // (3 x^2 + 2 x + 1) * (x + 1)
+  auto l = std::vector<std::pair<int, double>>{
+      {2, 3},
+      {1, 2},
+      {0, 1},
+  };
+  auto r = std::vector<std::pair<int, double>>{
+      {1, 1},
+      {0, 1},
+  };
+  auto result = std::vector<std::pair<int, double>>();
+  mvPolynomial::HeapMultiply(
+      r.size(),
+      l.size(),
+      [&](std::size_t i, std::size_t j) {
+        return std::pair<int, double>(r[i].first + l[j].first, r[i].second * l[j].second);
+      },
+      std::greater<int>(),
+      [&result](int index, double value) { result.emplace_back(index, value); }
+  );
+  auto ans = std::vector<std::pair<int, double>>{
+      {3, 3},
+      {2, 5},
+      {1, 3},
+      {0, 1},
+  };
+  BOOST_TEST(result == ans);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_multiply, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  auto l    = P({
+      {0, 1},
+      {1, 2},
+      {2, 3},
+  });
+  auto r    = P({
+      {0, 1},
+      {1, 1},
+  });
+  auto prod = l * r;
+  BOOST_TEST(prod.size() == 4);
+  BOOST_TEST(prod.at(0) == 1);
+  BOOST_TEST(prod.at(1) == 3);
+  BOOST_TEST(prod.at(2) == 5);
+  BOOST_TEST(prod.at(3) == 3);
+}
+
+BOOST_AUTO_TEST_CASE(
+    mvPolynomial_heap_multiply, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  auto engine = std::mt19937(0);
+  auto dist   = std::uniform_int_distribution<int>(0, 4);
+  auto random = [&engine, &dist](std::size_t n) {
+    auto p = MP3();
+    for (std::size_t i = 0; i != n; ++i) {
+      p[{dist(engine), dist(engine), dist(engine)}] += 1 + dist(engine);
+    }
+    return p;
+  };
+  auto l = random(30);
+  auto r = random(50);
+
+  // Multiply the terms naively.
+  auto comparer = mvPolynomial::IndexComparer<int, 3>();
+  auto ans      = std::map<Eigen::Array3i, double, decltype(comparer)>(comparer);
+  for (const auto& [l_idx, l_v] : l) {
+    for (const auto& [r_idx, r_v] : r) {
+      ans[l_idx + r_idx] += l_v * r_v;
+    }
+  }
+
+  // Multiply them by the heap with and without packed indexes.
+  auto big = MP3({
+      {{0, 0, 2000000}, 1}
+  });
+  for (const auto& prod : {l * r, r * l, (l * big) * r}) {
+    BOOST_TEST(prod.size() == ans.size());
+    auto it = ans.begin();
+    for (const auto& [index, value] : prod) {
+      auto shifted = Eigen::Array3i(it->first);
+      if (prod.front().first[2] >= 2000000) {
+        shifted[2] += 2000000;
+      }
+      BOOST_TEST((index == shifted).all());
+      BOOST_TEST(value == it->second);
+      ++it;
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(mvPolynomial_parallel_multiply) {
+  auto engine = std::mt19937(1);
+  auto dist   = std::uniform_int_distribution<int>(0, 9);
+  auto coeff  = std::uniform_real_distribution<double>(-1, 1);
+  auto random = [&](std::size_t n, int shift) {
+    auto p = MP3();
+    for (std::size_t i = 0; i != n; ++i) {
+      p[{dist(engine), dist(engine), dist(engine) + shift}] = coeff(engine);
+    }
+    return p;
+  };
+
+  // The latter doesn't fit in the packed indexes.
+  for (auto shift : {0, 2000000}) {
+    auto l   = random(200, shift);
+    auto r   = random(300, shift);
+    auto ans = l * r;
+    for (std::size_t n_threads : {1, 2, 3, 8}) {
+      auto prod = ParallelMultiply(l, r, n_threads);
+      BOOST_TEST(prod.size() == ans.size());
+      auto it = ans.begin();
+      for (const auto& [index, value] : prod) {
+        BOOST_TEST((index == it->first).all());
+        // The products are combined in the same order.
+        BOOST_TEST(value == it->second, tt::tolerance(0.0));
+        ++it;
+      }
+    }
+  }
+}
@@ -3,6 +3,8 @@
 #include "boost/test/unit_test.hpp"
 #include "mvPolynomial/mvPolynomial.hpp"
 
+#include <cmath>
+#include <thread>
 #include <vector>
 
 namespace utf = boost::unit_test;
@@ -46,6 +48,143 @@ BOOST_AUTO_TEST_CASE(mvPolynomial_Of, *utf::tolerance(tt::fpc::percent_tolerance
   BOOST_TEST(Of(m, {2, 3}) == 112);
 }
 
+// An order of indexes other than IndexComparer, under which Of uses the tables of powers.
+struct AscendingComparer {
+  bool operator()(const Eigen::Array2i& l, const Eigen::Array2i& r) const {
+    return l[0] < r[0] || (l[0] == r[0] && l[1] < r[1]);
+  }
+};
+
+BOOST_AUTO_TEST_CASE(mvPolynomial_degrees) {
+  auto m = MP2();
+  BOOST_TEST((m.degrees() == 0).all());
+  m[{3, 1}] = 1;
+  m.insert({{1, 4}, 2});
+  m.emplace_hint(m.end(), Eigen::Array2i(2, 2), 3);
+  BOOST_TEST(m.degrees()[0] == 3);
+  BOOST_TEST(m.degrees()[1] == 4);
+
+  m.erase(m.find({1, 4}));
+  BOOST_TEST(m.degrees()[0] == 3);
+  BOOST_TEST(m.degrees()[1] == 2);
+
+  auto d = D(m, 0);
+  BOOST_TEST(d.degrees()[0] == 2);
+  BOOST_TEST(d.degrees()[1] == 2);
+  auto product = m * m;
+  BOOST_TEST(product.degrees()[0] == 6);
+  BOOST_TEST(product.degrees()[1] == 4);
+
+  m.clear();
+  BOOST_TEST((m.degrees() == 0).all());
+}
+
+BOOST_AUTO_TEST_CASE(
+    mvPolynomial_Of_power_table, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  using AscendingMP2 = mvPolynomial::MVPolynomial<int, double, 2, AscendingComparer>;
+
+  auto m = AscendingMP2();
+  for (auto i = 0; i != 5; ++i) {
+    for (auto j = 0; j <= 6; j += 2) {
+      m[{i, j}] = 1.0 + i - 0.25 * j;
+    }
+  }
+  const auto x   = AscendingMP2::coord_type(1.5, -0.75);
+  auto       ans = 0.0;
+  for (const auto& [index, value] : m) {
+    ans += value * std::pow(x[0], index[0]) * std::pow(x[1], index[1]);
+  }
+  BOOST_TEST(Of(m, x) == ans);
+
+  m.erase(m.find({4, 6}));
+  ans -= (1.0 + 4 - 0.25 * 6) * std::pow(x[0], 4) * std::pow(x[1], 6);
+  BOOST_TEST(Of(m, x) == ans);
+}
+
+BOOST_AUTO_TEST_CASE(mvPolynomial_batch_Of, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  auto ans = std::vector<std::pair<Eigen::Array2i, double>>();
+  ans      = {
+      {{0, 0}, 1},
+      {{1, 0}, 2},
+      {{0, 1}, 3},
+      {{1, 1}, 4},
+      {{2, 0}, 5},
+      {{0, 2}, 6},
+  };
+
+  auto m  = MP2(ans.begin(), ans.end());
+  auto xs = mvPolynomial::CoordArrayType<double, 2>(2, 4);
+  xs << 0, 2, -1, 0.5, 0, 3, 2, -1.5;
+  auto values = Of(m, xs);
+  BOOST_TEST(values.size() == xs.cols());
+  BOOST_TEST(values[0] == 1);
+  BOOST_TEST(values[1] == 112);
+  for (auto i = 0; i < xs.cols(); ++i) {
+    BOOST_TEST(values[i] == Of(m, MP2::coord_type(xs.col(i))));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(
+    mvPolynomial_value_and_gradient, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  auto m = MP3();
+  for (auto i = 0; i != 4; ++i) {
+    for (auto j = 0; j != 3; ++j) {
+      m[{i, j, (i + 2 * j) % 4}] = 1.0 + i - 0.5 * j;
+    }
+  }
+  const auto x = MP3::coord_type(0.5, -1.25, 1.5);
+
+  const auto [value, gradient] = ValueAndGradient(m, x);
+  BOOST_TEST(value == Of(m, x));
+  for (auto k = 0; k != 3; ++k) {
+    BOOST_TEST(gradient[k] == Of(D(m, k), x));
+  }
+
+  const auto [h_value, h_gradient, hessian] = ValueGradientAndHessian(m, x);
+  BOOST_TEST(h_value == value);
+  for (auto k = 0; k != 3; ++k) {
+    BOOST_TEST(h_gradient[k] == gradient[k]);
+    for (auto l = 0; l != 3; ++l) {
+      BOOST_TEST(hessian(k, l) == Of(D(D(m, k), l), x));
+    }
+  }
+
+  auto exact_of                            = EO3(m);
+  const auto [exact_value, exact_gradient] = exact_of.value_and_gradient(x);
+  BOOST_TEST(exact_value == value);
+  for (auto k = 0; k != 3; ++k) {
+    BOOST_TEST(exact_gradient[k] == gradient[k]);
+  }
+  BOOST_TEST(exact_of(x) == value);
+}
+
+BOOST_AUTO_TEST_CASE(
+    mvPolynomial_value_and_gradient_2d, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  using AscendingMP2 = mvPolynomial::MVPolynomial<int, double, 2, AscendingComparer>;
+
+  auto m           = MP2();
+  auto ascending_m = AscendingMP2();
+  for (auto i = 0; i != 5; ++i) {
+    for (auto j = 0; j <= i; ++j) {
+      m[{i, j}] = ascending_m[{i, j}] = 0.5 * i - j;
+    }
+  }
+  const auto x = MP2::coord_type(-0.75, 2.0);
+
+  const auto [value, gradient]             = ValueAndGradient(ascending_m, x);
+  auto exact_of                            = mvPolynomial::ExactOf<int, double, 2>(m);
+  const auto [exact_value, exact_gradient] = exact_of.value_and_gradient(x);
+  BOOST_TEST(value == Of(m, x));
+  BOOST_TEST(exact_value == value);
+  for (auto k = 0; k != 2; ++k) {
+    BOOST_TEST(gradient[k] == Of(D(m, k), x));
+    BOOST_TEST(exact_gradient[k] == gradient[k]);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(mvPolynomial_derivative, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
   auto ans = std::vector<std::pair<Eigen::Array2i, double>>();
   ans      = {
@@ -129,6 +268,36 @@ BOOST_AUTO_TEST_CASE(mvPolynomial_multiply, *utf::tolerance(tt::fpc::percent_tol
   }
 }
 
+BOOST_AUTO_TEST_CASE(
+    mvPolynomial_multiply_combine, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  // (1 + x + y)^2 has the products which have the same index.
+  auto l    = MP2({
+      {{0, 0}, 1},
+      {{1, 0}, 1},
+      {{0, 1}, 1},
+  });
+  auto prod = l * l;
+  BOOST_TEST(prod.size() == 6);
+  BOOST_TEST(prod.at({0, 0}) == 1);
+  BOOST_TEST(prod.at({1, 0}) == 2);
+  BOOST_TEST(prod.at({0, 1}) == 2);
+  BOOST_TEST(prod.at({2, 0}) == 1);
+  BOOST_TEST(prod.at({1, 1}) == 2);
+  BOOST_TEST(prod.at({0, 2}) == 1);
+
+  // The indexes of the product don't fit in the packed indexes.
+  auto m        = MP3({
+      {{600000, 0, 0}, 2},
+      {{0, 0, 1}, 3},
+  });
+  auto big_prod = m * m;
+  BOOST_TEST(big_prod.size() == 3);
+  BOOST_TEST(big_prod.at({1200000, 0, 0}) == 4);
+  BOOST_TEST(big_prod.at({600000, 0, 1}) == 12);
+  BOOST_TEST(big_prod.at({0, 0, 2}) == 9);
+}
+
 BOOST_AUTO_TEST_CASE(mvPolynomial_sum, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
   auto ans = std::vector<std::pair<Eigen::Array2i, double>>();
   ans      = {
@@ -181,6 +350,59 @@ BOOST_AUTO_TEST_CASE(mvPolynomial_sub, *utf::tolerance(tt::fpc::percent_toleranc
   }
 }
 
+BOOST_AUTO_TEST_CASE(
+    mvPolynomial_compound_assignment, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  auto l = MP2({
+      {{0, 0}, 1},
+      {{1, 0}, 2},
+      {{0, 1}, 3},
+  });
+  auto m = MP2({
+      {{2, 0}, 5},
+      {{1, 0}, 4},
+      {{0, 2}, 7},
+  });
+
+  auto sum = l;
+  sum.reserve(8);
+  const auto* data = &*sum.begin();
+  sum += m;
+  // The sequence isn't reallocated since its capacity suffices.
+  BOOST_TEST(&*sum.begin() == data);
+  auto ans = l + m;
+  BOOST_TEST(sum.size() == ans.size());
+  for (const auto& [index, value] : ans) {
+    BOOST_TEST(sum.at(index) == value);
+  }
+
+  auto sub = l;
+  sub -= m;
+  ans = l - m;
+  BOOST_TEST(sub.size() == ans.size());
+  for (const auto& [index, value] : ans) {
+    BOOST_TEST(sub.at(index) == value);
+  }
+
+  auto twice = l;
+  twice += twice;
+  for (const auto& [index, value] : l) {
+    BOOST_TEST(twice.at(index) == 2 * value);
+  }
+  twice -= twice;
+  for (const auto& [index, value] : l) {
+    BOOST_TEST(twice.at(index) == 0);
+  }
+
+  auto prod = l;
+  prod *= m;
+  ans = l * m;
+  BOOST_TEST(prod.size() == ans.size());
+  for (const auto& [index, value] : ans) {
+    BOOST_TEST(prod.at(index) == value);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(
     mvPolynomial_default_value_check, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
 ) {
@@ -254,3 +476,122 @@ BOOST_AUTO_TEST_CASE(
   BOOST_TEST(exact_of({0, 1, 1}) == 1 + 3 + 6 + 4 + 7 + 9);
   BOOST_TEST(exact_of({1, 0, 1}) == 1 + 2 + 5 + 4 + 7 + 10);
 }
+
+BOOST_AUTO_TEST_CASE(
+    mvPolynomial_exact_of_batch, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  auto ans = std::vector<std::pair<Eigen::Vector3i, double>>();
+  ans      = {
+      {{0, 0, 0},  1},
+      {{1, 0, 0},  2},
+      {{0, 1, 0},  3},
+      {{0, 0, 1},  4},
+      {{2, 0, 0},  5},
+      {{1, 1, 0},  8},
+      {{0, 1, 1},  9},
+      {{1, 0, 1}, 10},
+  };
+  auto m        = MP3(ans.begin(), ans.end());
+  auto exact_of = EO3(m);
+  auto xs       = mvPolynomial::CoordArrayType<double, 3>(3, 3);
+  xs << 0, 1, 2, 0, 0.5, -1, 0, 2, 3;
+  auto values = exact_of(xs);
+  for (auto i = 0; i < xs.cols(); ++i) {
+    BOOST_TEST(values[i] == exact_of(EO3::polynomial_type::coord_type(xs.col(i))));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(
+    mvPolynomial_exact_of_const, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  auto m = MP3();
+  for (auto i = 0; i != 5; ++i) {
+    for (auto j = 0; j != 4; ++j) {
+      m[{i, j, (i * j) % 5}] = 1.0 + i - 0.5 * j;
+    }
+  }
+  const auto exact_of = EO3(m);
+
+  // Each thread has its own workspace and shares exact_of.
+  const auto n_threads = 4;
+  const auto n_points  = 64;
+  auto       values    = std::vector<double>(n_threads * n_points);
+  auto       threads   = std::vector<std::thread>();
+  for (auto t = 0; t != n_threads; ++t) {
+    threads.emplace_back([&exact_of, &values, t]() {
+      auto workspace = exact_of.make_workspace();
+      for (auto k = 0; k != n_points; ++k) {
+        const auto x = MP3::coord_type(0.01 * k, -0.5 + 0.1 * t, 1.0 - 0.02 * k);
+        values[t * n_points + k] = exact_of(x, workspace);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (auto t = 0; t != n_threads; ++t) {
+    for (auto k = 0; k != n_points; ++k) {
+      const auto x = MP3::coord_type(0.01 * k, -0.5 + 0.1 * t, 1.0 - 0.02 * k);
+      BOOST_TEST(values[t * n_points + k] == Of(m, x));
+    }
+  }
+
+  // The value and the gradient are also calculated by threads sharing exact_of.
+  auto gradients = std::vector<std::pair<double, MP3::coord_type>>(n_threads * n_points);
+  threads.clear();
+  for (auto t = 0; t != n_threads; ++t) {
+    threads.emplace_back([&exact_of, &gradients, t]() {
+      auto workspace = exact_of.make_workspace();
+      for (auto k = 0; k != n_points; ++k) {
+        const auto x = MP3::coord_type(0.01 * k, -0.5 + 0.1 * t, 1.0 - 0.02 * k);
+        gradients[t * n_points + k] = exact_of.value_and_gradient(x, workspace);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (auto t = 0; t != n_threads; ++t) {
+    for (auto k = 0; k != n_points; ++k) {
+      const auto x                 = MP3::coord_type(0.01 * k, -0.5 + 0.1 * t, 1.0 - 0.02 * k);
+      const auto [value, gradient] = ValueAndGradient(m, x);
+      const auto& [exact_value, exact_gradient] = gradients[t * n_points + k];
+      BOOST_TEST(exact_value == value);
+      for (auto axis = 0; axis != 3; ++axis) {
+        BOOST_TEST(exact_gradient[axis] == gradient[axis]);
+      }
+    }
+  }
+
+  // A copy doesn't refer to the original.
+  auto copy = EO3();
+  {
+    auto original = EO3(m);
+    copy          = original;
+  }
+  const auto x = MP3::coord_type(0.5, -0.25, 0.75);
+  BOOST_TEST(copy(x) == Of(m, x));
+}
+
+BOOST_AUTO_TEST_CASE(
+    mvPolynomial_over_aligned_index, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  // The indexes of 8 and 16 dimensions are over-aligned with AVX and AVX-512, so the default
+  // allocator must respect the alignment of the terms.
+  using MP8  = mvPolynomial::MVPolynomial<int, double, 8>;
+  using MP16 = mvPolynomial::MVPolynomial<int, double, 16>;
+
+  auto p = MP8();
+  auto q = MP16();
+  for (auto i = 0; i != 8; ++i) {
+    p[MP8::index_type::Constant(i % 3)]   = 1.0 + i;
+    q[MP16::index_type::Constant(i % 2)] += 0.5 * i;
+  }
+  const auto pp = p * p;
+  const auto qq = q * q;
+  const auto x  = MP8::coord_type::Constant(0.75);
+  const auto y  = MP16::coord_type::Constant(0.75);
+  BOOST_TEST(Of(pp, x) == Of(p, x) * Of(p, x));
+  BOOST_TEST(Of(qq, y) == Of(q, y) * Of(q, y));
+  BOOST_TEST(Of(D(pp, 7), x) == 2 * Of(p, x) * Of(D(p, 7), x));
+}
@@ -0,0 +1,95 @@
+#define BOOST_TEST_MODULE packed_index_unit_test
+
+#include "boost/test/unit_test.hpp"
+#include "mvPolynomial/packed_index.hpp"
+#include "mvPolynomial/index_comparer.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using Packer3  = mvPolynomial::PackedIndex<int, 3>;
+using Packer20 = mvPolynomial::DefaultPackedIndex<int, 20>;
+
+BOOST_AUTO_TEST_CASE(packed_index_pack) {
+  static_assert(Packer3::bits == 21);
+  static_assert(Packer3::max_element == (1 << 20) - 1);
+  static_assert(std::is_same_v<Packer20::word_type, unsigned __int128>);
+  static_assert(Packer20::bits == 6);
+
+  auto indexes = std::vector<Eigen::Array3i>{
+      {0, 0, 0},
+      {1, 2, 3},
+      {Packer3::max_element, 0, 7},
+      {5, Packer3::max_element, Packer3::max_element},
+  };
+  for (const auto& index : indexes) {
+    BOOST_TEST(Packer3::CanPack(index));
+    BOOST_TEST((Packer3::Unpack(Packer3::Pack(index)) == index).all());
+  }
+  BOOST_TEST(!Packer3::CanPack({-1, 0, 0}));
+  BOOST_TEST(!Packer3::CanPack({0, Packer3::max_element + 1, 0}));
+
+  auto index20 = Eigen::Array<int, 20, 1>();
+  for (auto i = 0; i != 20; ++i) {
+    index20[i] = i % (Packer20::max_element + 1);
+  }
+  BOOST_TEST((Packer20::Unpack(Packer20::Pack(index20)) == index20).all());
+}
+
+BOOST_AUTO_TEST_CASE(packed_index_order) {
+  auto comparer = mvPolynomial::IndexComparer<int, 3>();
+  auto indexes  = std::vector<Eigen::Array3i>{
+      {0, 0, 0},
+      {1, 0, 0},
+      {0, 1, 0},
+      {0, 0, 1},
+      {1, 1, 0},
+      {0, 3, 9},
+      {2, 0, 0},
+      {1, 0, 5},
+  };
+  for (const auto& l : indexes) {
+    for (const auto& r : indexes) {
+      BOOST_TEST(comparer(l, r) == (Packer3::Pack(l) > Packer3::Pack(r)));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(packed_index_add) {
+  auto l   = Packer3::Pack({1, 2, 3});
+  auto r   = Packer3::Pack({4, 5, 6});
+  auto sum = Packer3::Add(l, r);
+  BOOST_TEST(sum.has_value());
+  BOOST_TEST((Packer3::Unpack(*sum) == Eigen::Array3i(5, 7, 9)).all());
+
+  auto big = Packer3::Pack({0, Packer3::max_element, 0});
+  BOOST_TEST(!Packer3::Add(big, Packer3::Pack({0, 1, 0})).has_value());
+  BOOST_TEST(Packer3::Add(big, Packer3::Pack({1, 0, 1})).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(packed_index_one_dimension) {
+  // An element never takes more bits than IntType plus a guard bit, so overflow is detected.
+  using Packer1  = mvPolynomial::PackedIndex<int, 1>;
+  using Packer1L = mvPolynomial::PackedIndex<std::int64_t, 1>;
+  using Index1   = Packer1::index_type;
+  using Index1L  = Packer1L::index_type;
+  static_assert(Packer1::bits == 32);
+  static_assert(Packer1::max_element == std::numeric_limits<int>::max());
+  static_assert(Packer1L::bits == 64);
+  static_assert(Packer1L::max_element == std::numeric_limits<std::int64_t>::max());
+
+  const auto index = Index1::Constant(Packer1::max_element);
+  BOOST_TEST((Packer1::Unpack(Packer1::Pack(index)) == index).all());
+  const auto sum =
+      Packer1::Add(Packer1::Pack(Index1::Constant(3)), Packer1::Pack(Index1::Constant(4)));
+  BOOST_TEST(sum.has_value());
+  BOOST_TEST(Packer1::Unpack(*sum)[0] == 7);
+  BOOST_TEST(!Packer1::Add(Packer1::Pack(index), Packer1::Pack(Index1::Constant(1))).has_value());
+
+  const auto long_index = Index1L::Constant(Packer1L::max_element);
+  BOOST_TEST((Packer1L::Unpack(Packer1L::Pack(long_index)) == long_index).all());
+  BOOST_TEST(
+      !Packer1L::Add(Packer1L::Pack(long_index), Packer1L::Pack(Index1L::Constant(1))).has_value()
+  );
+}
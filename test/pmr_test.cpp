@@ -0,0 +1,196 @@
+#define BOOST_TEST_MODULE pmr_unit_test
+
+#include "boost/test/unit_test.hpp"
+#include "mvPolynomial/pmr.hpp"
+#include "mvPolynomial/dense_mvPolynomial.hpp"
+#include "mvPolynomial/expression.hpp"
+#include "mvPolynomial/integration.hpp"
+#include "mvPolynomial/mvPolynomial.hpp"
+#include "mvPolynomial/polynomial_product.hpp"
+#include "mvPolynomial/sum.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+namespace utf = boost::unit_test;
+namespace tt  = boost::test_tools;
+
+// Count the allocations from the global heap.
+std::atomic<std::size_t> n_global_allocations{0};
+
+void* operator new(std::size_t size) {
+  ++n_global_allocations;
+  if (auto p = std::malloc(size == 0 ? 1 : size)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+using MP3     = mvPolynomial::DefaultMVPolynomial<int, double, 3>;
+using PmrMP3  = mvPolynomial::pmr::DefaultMVPolynomial<int, double, 3>;
+using PmrPoly = mvPolynomial::pmr::DefaultPolynomial<int, double>;
+
+template <class P>
+P MakeP() {
+  auto p = P();
+  for (auto i = 0; i != 4; ++i) {
+    for (auto j = 0; j != 4; ++j) {
+      p[{i, j, i + j}] = 1.0 + i - 0.5 * j;
+    }
+  }
+  return p;
+}
+
+BOOST_AUTO_TEST_CASE(pmr_same_as_default, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  auto arena = mvPolynomial::pmr::Arena();
+
+  const auto p     = MakeP<MP3>();
+  const auto pmr_p = MakeP<PmrMP3>();
+  const auto mul   = p * p;
+  const auto pmr_m = pmr_p * pmr_p;
+  BOOST_TEST(pmr_m.size() == mul.size());
+  auto it = mul.begin();
+  for (const auto& [index, value] : pmr_m) {
+    BOOST_TEST((index == it->first).all());
+    BOOST_TEST(value == it->second);
+    ++it;
+  }
+
+  const auto x = typename MP3::coord_type(0.5, -0.25, 0.75);
+  BOOST_TEST(Of(D(pmr_m, 1), x) == Of(D(mul, 1), x));
+  BOOST_TEST(Of(Integrate(pmr_m, 2), x) == Of(Integrate(mul, 2), x));
+  auto exact_of = mvPolynomial::pmr::ExactOf<int, double, 3>(pmr_m);
+  BOOST_TEST(exact_of(x) == Of(mul, x));
+
+  auto pmr_q = PmrPoly();
+  auto q     = mvPolynomial::DefaultPolynomial<int, double>();
+  for (auto i = 0; i != 5; ++i) {
+    pmr_q[i] = q[i] = 1.0 / (i + 1);
+  }
+  BOOST_TEST(Of(pmr_q * pmr_q, 0.5) == Of(q * q, 0.5));
+}
+
+BOOST_AUTO_TEST_CASE(pmr_arena_scope) {
+  auto* const default_resource = std::pmr::get_default_resource();
+  {
+    auto arena = mvPolynomial::pmr::Arena();
+    BOOST_TEST(std::pmr::get_default_resource() == arena.resource());
+    {
+      auto nested = mvPolynomial::pmr::Arena();
+      BOOST_TEST(std::pmr::get_default_resource() == nested.resource());
+      auto p = PmrMP3(nested.get_allocator());
+      BOOST_TEST(p.get_allocator().resource() == nested.resource());
+    }
+    BOOST_TEST(std::pmr::get_default_resource() == arena.resource());
+  }
+  BOOST_TEST(std::pmr::get_default_resource() == default_resource);
+}
+
+BOOST_AUTO_TEST_CASE(pmr_no_global_allocation) {
+  alignas(std::max_align_t) static std::array<std::byte, 1 << 22> buffer;
+
+  auto value  = 0.0;
+  auto before = std::size_t(0);
+  auto after  = std::size_t(0);
+  {
+    auto arena = mvPolynomial::pmr::Arena(
+        buffer.data(), buffer.size(), std::pmr::null_memory_resource()
+    );
+    before = n_global_allocations.load();
+
+    const auto p = MakeP<PmrMP3>();
+    const auto q = D(p * p, 0) - Integrate(p, 1);
+    auto       r = p;
+    r += q;
+    r *= p;
+    const auto ps  = std::pmr::vector<PmrMP3>{p, q, r};
+    const auto sum = mvPolynomial::Sum(ps);
+    const auto e   = PmrMP3(mvPolynomial::Lazy(p) * q + 2.0 * mvPolynomial::Lazy(r));
+    auto       f   = mvPolynomial::pmr::ExactOf<int, double, 3>(sum + e);
+    value          = f(typename PmrMP3::coord_type(0.5, -0.25, 0.75));
+
+    after = n_global_allocations.load();
+  }
+  BOOST_TEST(after == before);
+  BOOST_TEST(value != 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(pmr_polynomial_product_no_global_allocation) {
+  alignas(std::max_align_t) static std::array<std::byte, 1 << 20> buffer;
+
+  auto value  = 0.0;
+  auto box    = 0.0;
+  auto before = std::size_t(0);
+  auto after  = std::size_t(0);
+  {
+    auto arena = mvPolynomial::pmr::Arena(
+        buffer.data(), buffer.size(), std::pmr::null_memory_resource()
+    );
+    before = n_global_allocations.load();
+
+    const auto pp = mvPolynomial::PolynomialProduct<PmrPoly, 3>({
+        PmrPoly({{0, 1}, {2, -3}}),
+        PmrPoly({{1, 2}, {3, 0.5}}),
+        PmrPoly({{0, 4}, {1, 1}}),
+    });
+    const auto expanded = mvPolynomial::Expand(pp);
+    const auto factored = mvPolynomial::TryFactor(expanded);
+    const auto of       = mvPolynomial::PolynomialProductOf<PmrPoly, 3>(pp);
+    auto       xs       = mvPolynomial::CoordArrayType<double, 3>(3, 2);
+    xs << 0.5, 0.5, -0.25, -0.25, 0.75, 1.5;
+    const auto values = of(xs);
+    value = factored ? Of(*factored, typename PmrMP3::coord_type(0.5, -0.25, 0.75)) - values[0]
+                     : 1.0;
+    const auto lo = typename PmrMP3::coord_type(0.0, -1.0, 0.5);
+    const auto hi = typename PmrMP3::coord_type(1.0, 0.5, 2.0);
+    box           = IntegrateBox(pp, lo, hi) - IntegrateBox(expanded, lo, hi);
+
+    after = n_global_allocations.load();
+  }
+  BOOST_TEST(after == before);
+  BOOST_TEST(value == 0.0, tt::tolerance(1e-12));
+  BOOST_TEST(box == 0.0, tt::tolerance(1e-12));
+}
+
+BOOST_AUTO_TEST_CASE(pmr_dense_no_global_allocation) {
+  using PmrDense2 =
+      mvPolynomial::DenseMVPolynomial<int, double, 2, std::pmr::polymorphic_allocator<double>>;
+
+  alignas(std::max_align_t) static std::array<std::byte, 1 << 20> buffer;
+
+  auto value  = 0.0;
+  auto before = std::size_t(0);
+  auto after  = std::size_t(0);
+  {
+    auto arena = mvPolynomial::pmr::Arena(
+        buffer.data(), buffer.size(), std::pmr::null_memory_resource()
+    );
+    before = n_global_allocations.load();
+
+    // The products of these sequences are longer than karatsuba_threshold.
+    auto p = PmrDense2(typename PmrDense2::index_type(5, 5), arena.get_allocator());
+    for (auto i = 0; i <= 5; ++i) {
+      for (auto j = 0; j <= 5; ++j) {
+        p[{i, j}] = 1.0 + i - 0.5 * j;
+      }
+    }
+    const auto mul    = p * p;
+    const auto sparse = mul.ToMVPolynomial();
+    const auto x      = typename PmrDense2::coord_type(0.5, -0.25);
+    BOOST_TEST(sparse.get_allocator().resource() == arena.resource());
+    value = Of(mul, x) - Of(sparse, x);
+
+    after = n_global_allocations.load();
+  }
+  BOOST_TEST(after == before);
+  BOOST_TEST(value == 0.0, tt::tolerance(1e-12));
+}
@@ -0,0 +1,109 @@
+#define BOOST_TEST_MODULE polynomial_product_sum_unit_test
+
+#include "boost/test/unit_test.hpp"
+#include "mvPolynomial/polynomial.hpp"
+#include "mvPolynomial/polynomial_product.hpp"
+#include "mvPolynomial/polynomial_product_sum.hpp"
+
+namespace utf = boost::unit_test;
+namespace tt  = boost::test_tools;
+
+using Poly = mvPolynomial::Polynomial<int, double>;
+using PP   = mvPolynomial::PolynomialProduct<Poly, 2>;
+using PPS  = mvPolynomial::PolynomialProductSum<Poly, 2>;
+
+// (1 + x) * (1 + y^2) + x^3 * (2 - y)
+PPS MakeSum() {
+  return PPS({
+      PP({Poly({{0, 1}, {1, 1}}), Poly({{0, 1}, {2, 1}})}),
+      PP({Poly({{3, 1}}), Poly({{0, 2}, {1, -1}})}),
+  });
+}
+
+double Expected(double x, double y) { return (1 + x) * (1 + y * y) + x * x * x * (2 - y); }
+
+BOOST_AUTO_TEST_CASE(
+    polynomial_product_sum_of, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  const auto s = MakeSum();
+  BOOST_TEST(s.rank() == 2);
+  BOOST_TEST(Of(s, PP::coord_type(0.5, -1.5)) == Expected(0.5, -1.5));
+  BOOST_TEST(Of(PPS(), PP::coord_type(0.5, -1.5)) == 0);
+
+  auto xs = mvPolynomial::CoordArrayType<double, 2>(2, 5);
+  xs << -1, -0.5, 0, 0.5, 1, 2, 1, 0, -1, -2;
+  const auto values = Of(s, xs);
+  for (auto k = 0; k != 5; ++k) {
+    BOOST_TEST(values[k] == Expected(xs(0, k), xs(1, k)));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(
+    polynomial_product_sum_compress, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  // (1 + x) * y + (1 + x) * y^2 = (1 + x) * (y + y^2)
+  auto s = PPS({
+      PP({Poly({{0, 1}, {1, 1}}), Poly({{1, 1}})}),
+      PP({Poly({{0, 1}, {1, 1}}), Poly({{2, 1}})}),
+  });
+  s.compress();
+  BOOST_TEST(s.rank() == 1);
+  BOOST_TEST((s[0][1] == Poly({{1, 1}, {2, 1}})));
+
+  // Identical products are merged into one.
+  auto doubled = MakeSum() + MakeSum();
+  BOOST_TEST(doubled.rank() == 2);
+  BOOST_TEST(Of(doubled, PP::coord_type(0.5, -1.5)) == 2 * Expected(0.5, -1.5));
+
+  // The difference from itself vanishes.
+  const auto zero = MakeSum() - MakeSum();
+  BOOST_TEST(zero.rank() == 0);
+
+  // Adding or subtracting itself doesn't read the products being inserted.
+  auto self = MakeSum();
+  self += self;
+  BOOST_TEST(self.rank() == 2);
+  BOOST_TEST(Of(self, PP::coord_type(0.5, -1.5)) == 2 * Expected(0.5, -1.5));
+  self -= self;
+  BOOST_TEST(self.rank() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(
+    polynomial_product_sum_multiply, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  const auto s = MakeSum();
+  const auto t = PPS({
+      PP({Poly({{1, 2}}), Poly({{0, 1}})}),
+      PP({Poly({{0, 1}}), Poly({{1, 3}})}),
+  });
+  const auto st = s * t;
+  BOOST_TEST(st.rank() <= s.rank() * t.rank());
+
+  const auto x = PP::coord_type(0.5, -1.5);
+  BOOST_TEST(Of(st, x) == Of(s, x) * Of(t, x));
+
+  auto scaled = s;
+  scaled *= 3;
+  BOOST_TEST(Of(scaled, x) == 3 * Of(s, x));
+}
+
+BOOST_AUTO_TEST_CASE(
+    polynomial_product_sum_d_integrate, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  const auto s = MakeSum();
+  const auto x = PP::coord_type(0.5, -1.5);
+
+  // (1 + y^2) + 3 x^2 (2 - y)
+  const auto dx = mvPolynomial::D(s, 0);
+  BOOST_TEST(Of(dx, x) == (1 + 2.25) + 3 * 0.25 * (2 + 1.5));
+  // 2 y (1 + x) - x^3
+  const auto dy = mvPolynomial::D(s, 1);
+  BOOST_TEST(Of(dy, x) == 2 * -1.5 * 1.5 - 0.125);
+
+  // A product which doesn't depend on y vanishes.
+  const auto constant = PPS({PP({Poly({{2, 1}}), Poly({{0, 4}})})});
+  BOOST_TEST(mvPolynomial::D(constant, 1).rank() == 0);
+
+  const auto integral = mvPolynomial::Integrate(s, 1);
+  BOOST_TEST(Of(mvPolynomial::D(integral, 1), x) == Of(s, x));
+}
@@ -4,6 +4,8 @@
 #include "mvPolynomial/polynomial_product.hpp"
 #include "mvPolynomial/polynomial.hpp"
 
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace utf = boost::unit_test;
@@ -104,3 +106,186 @@ BOOST_AUTO_TEST_CASE(
     BOOST_TEST(v[i] == spp1[i]);
   }
 }
+
+BOOST_AUTO_TEST_CASE(
+    polynomial_product_multiply, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  auto l = mvPolynomial::PolynomialProduct<Poly, 2>({Poly({{0, 1}, {1, 2}}), Poly({{2, 3}})});
+  auto r = mvPolynomial::PolynomialProduct<Poly, 2>({Poly({{1, 1}}), Poly({{0, 4}, {1, 5}})});
+  auto m = l * r;
+  BOOST_TEST(m[0] == l[0] * r[0]);
+  BOOST_TEST(m[1] == l[1] * r[1]);
+
+  auto d = mvPolynomial::D(mvPolynomial::PolynomialProduct<Poly, 2>(l), 0);
+  BOOST_TEST(d[0] == mvPolynomial::D(l[0]));
+  BOOST_TEST(d[1] == l[1]);
+  auto s = mvPolynomial::Integrate(mvPolynomial::PolynomialProduct<Poly, 2>(l), 1);
+  BOOST_TEST(s[0] == l[0]);
+  BOOST_TEST(s[1] == mvPolynomial::Integrate(l[1]));
+
+  BOOST_CHECK_THROW(mvPolynomial::D(l, 2), std::out_of_range);
+  auto rvalue = l;
+  BOOST_CHECK_THROW(mvPolynomial::D(std::move(rvalue), 2), std::out_of_range);
+  BOOST_CHECK_THROW(mvPolynomial::Integrate(std::move(rvalue), 2), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_product_of_class) {
+  using PP = mvPolynomial::PolynomialProduct<Poly, 3>;
+
+  auto pp = PP({
+      Poly({{0, 1}, {1, 2}, {2, 3}}),
+      Poly({{0, 4}, {3, -5}, {7, 0.5}}),
+      Poly({{1, -1.5}, {4, 2}}),
+  });
+  const auto of = mvPolynomial::PolynomialProductOf<Poly, 3>(pp);
+
+  const auto x = PP::coord_type(0.5, -1.25, 2);
+  BOOST_TEST(of(x) == Of(pp, x));
+
+  // A tensor grid of 4 x 3 x 2 points has few unique coordinates.
+  auto xs = mvPolynomial::CoordArrayType<double, 3>(3, 24);
+  auto k  = 0;
+  for (auto i = 0; i != 4; ++i) {
+    for (auto j = 0; j != 3; ++j) {
+      for (auto l = 0; l != 2; ++l, ++k) {
+        xs.col(k) << 0.25 * i, -0.5 + 0.75 * j, 1.5 - l;
+      }
+    }
+  }
+  const auto values = of(xs);
+  for (k = 0; k != 24; ++k) {
+    const PP::coord_type y = xs.col(k);
+    BOOST_TEST(values[k] == Of(pp, y));
+  }
+
+  // A zero polynomial makes the product zero.
+  pp[1]             = Poly();
+  const auto zero_of = mvPolynomial::PolynomialProductOf<Poly, 3>(pp);
+  BOOST_TEST(zero_of(x) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_product_of_on_grid) {
+  using PP = mvPolynomial::PolynomialProduct<Poly, 3>;
+
+  const auto pp = PP({
+      Poly({{0, 1}, {1, 2}, {2, 3}}),
+      Poly({{0, 4}, {3, -5}, {7, 0.5}}),
+      Poly({{1, -1.5}, {4, 2}}),
+  });
+  const auto xs = std::vector<double>{-1, 0.5, 2};
+  const auto ys = std::vector<double>{0.25, -0.75};
+  const auto zs = Eigen::ArrayXd::LinSpaced(5, -1, 1).eval();
+
+  auto values = std::vector<double>(xs.size() * ys.size() * zs.size());
+  mvPolynomial::OfOnGrid(pp, values, xs, ys, zs);
+  auto k = std::size_t(0);
+  for (auto x : xs) {
+    for (auto y : ys) {
+      for (auto z : zs) {
+        // The values are bit-identical to Of.
+        BOOST_TEST(values[k++] == Of(pp, PP::coord_type(x, y, z)));
+      }
+    }
+  }
+
+  const auto returned = mvPolynomial::OfOnGrid(pp, xs, ys, zs);
+  BOOST_TEST(static_cast<std::size_t>(returned.size()) == values.size());
+  for (k = 0; k != values.size(); ++k) {
+    BOOST_TEST(returned[k] == values[k]);
+  }
+
+  auto small = std::vector<double>(3);
+  BOOST_CHECK_THROW(mvPolynomial::OfOnGrid(pp, small, xs, ys, zs), std::runtime_error);
+
+  // A grid with an empty axis has no points.
+  const auto empty = mvPolynomial::OfOnGrid(pp, xs, std::vector<double>(), zs);
+  BOOST_TEST(empty.size() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_product_of_on_grid_1d) {
+  const auto pp     = mvPolynomial::PolynomialProduct<Poly, 1>({Poly({{0, 1}, {2, -3}})});
+  const auto xs     = std::vector<double>{-1, 0.5, 2};
+  const auto values = mvPolynomial::OfOnGrid(pp, xs);
+  for (std::size_t k = 0; k != xs.size(); ++k) {
+    BOOST_TEST(values[k] == Of(pp[0], xs[k]));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(
+    polynomial_product_expand, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  using PP = mvPolynomial::PolynomialProduct<Poly, 3>;
+
+  const auto pp = PP({
+      Poly({{0, 1}, {1, 2}, {2, 3}}),
+      Poly({{0, 4}, {3, -5}}),
+      Poly({{1, -1.5}, {4, 2}}),
+  });
+  const auto p = mvPolynomial::Expand(pp);
+  BOOST_TEST(p.size() == 12);
+  BOOST_TEST(p.at({2, 3, 4}) == 3 * -5 * 2);
+  BOOST_TEST(p.at({0, 0, 1}) == 1 * 4 * -1.5);
+
+  // The expansion equals the product of the lifted polynomials.
+  using MP3         = mvPolynomial::MVPolynomial<int, double, 3>;
+  auto       lifted = std::array<MP3, 3>();
+  for (int axis = 0; axis != 3; ++axis) {
+    lifted[axis].clear();
+    for (const auto& [i, c] : pp[axis]) {
+      auto index  = MP3::index_type(0, 0, 0);
+      index[axis] = i;
+      lifted[axis][index] = c;
+    }
+  }
+  const auto expected = lifted[0] * lifted[1] * lifted[2];
+  BOOST_TEST(p.size() == expected.size());
+  for (const auto& [index, value] : expected) {
+    BOOST_TEST(p.at(index) == value);
+  }
+
+  const auto x = PP::coord_type(0.5, -1.25, 2);
+  BOOST_TEST(Of(p, x) == Of(pp, x));
+
+  auto zero = pp;
+  zero[1].clear();
+  const auto expanded_zero = mvPolynomial::Expand(zero);
+  BOOST_TEST(expanded_zero.size() == 1);
+  BOOST_TEST(Of(expanded_zero, x) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(
+    polynomial_product_try_factor, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  using PP = mvPolynomial::PolynomialProduct<Poly, 3>;
+
+  const auto pp = PP({
+      Poly({{0, 1}, {1, 2}, {2, 3}}),
+      Poly({{0, 4}, {3, -5}}),
+      Poly({{1, -1.5}, {4, 2}}),
+  });
+  const auto p       = mvPolynomial::Expand(pp);
+  const auto factors = mvPolynomial::TryFactor(p);
+  BOOST_TEST_REQUIRE(factors.has_value());
+  for (int axis = 0; axis != 3; ++axis) {
+    BOOST_TEST((*factors)[axis].size() == pp[axis].size());
+  }
+  const auto expanded = mvPolynomial::Expand(*factors);
+  BOOST_TEST(expanded.size() == p.size());
+  for (const auto& [index, value] : p) {
+    BOOST_TEST(expanded.at(index) == value);
+  }
+
+  // A missing term breaks the Cartesian product of indexes.
+  auto missing = p;
+  missing.erase(missing.begin());
+  BOOST_TEST(!mvPolynomial::TryFactor(missing).has_value());
+
+  // A changed coefficient breaks the products of coefficients.
+  auto changed         = p;
+  changed.at({1, 0, 1}) += 1;
+  BOOST_TEST(!mvPolynomial::TryFactor(changed).has_value());
+
+  const auto zero = mvPolynomial::TryFactor(mvPolynomial::MVPolynomial<int, double, 3>());
+  BOOST_TEST_REQUIRE(zero.has_value());
+  BOOST_TEST(Of(*zero, PP::coord_type(0.5, -1.25, 2)) == 0);
+}
@@ -37,6 +37,42 @@ BOOST_AUTO_TEST_CASE(polynomial_Of, *utf::tolerance(tt::fpc::percent_tolerance(1
   BOOST_TEST(Of(m, 2) == 17);
 }
 
+BOOST_AUTO_TEST_CASE(polynomial_batch_Of, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  auto ans = std::vector<std::pair<int, double>>();
+  ans      = {
+      {0, 1},
+      {1, 2},
+      {3, 3}
+  };
+
+  auto m  = Poly(ans.begin(), ans.end());
+  auto xs = mvPolynomial::ValueArrayType<double>(4);
+  xs << 0, 2, -1, 0.5;
+  auto values = Of(m, xs);
+  BOOST_TEST(values.size() == xs.size());
+  for (auto i = 0; i < xs.size(); ++i) {
+    BOOST_TEST(values[i] == Of(m, xs[i]));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(polynomial_simd_Of) {
+  auto m = Poly({
+      { 0,  1},
+      { 1, -2},
+      { 5,  3},
+      {13, -4}
+  });
+
+  auto xs = Eigen::Array<double, 1, 8>();
+  xs << 0, 1, -1, 0.5, -0.75, 1.25, 2, -3;
+  auto values = Of(m, xs);
+  for (auto i = 0; i < xs.size(); ++i) {
+    // The vectorized path must be bit-identical to the scalar one.
+    BOOST_TEST(values[i] == Of(m, xs[i]), tt::tolerance(0.0));
+  }
+  BOOST_TEST(values[1] == 1 - 2 + 3 - 4, tt::tolerance(0.0));
+}
+
 BOOST_AUTO_TEST_CASE(polynomial_derivative, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
   auto ans = std::vector<std::pair<int, double>>();
   ans      = {
@@ -73,3 +109,39 @@ BOOST_AUTO_TEST_CASE(polynomial_integral, *utf::tolerance(tt::fpc::percent_toler
     BOOST_TEST(sm[ans[i].first] == ans[i].second);
   }
 }
+
+BOOST_AUTO_TEST_CASE(
+    polynomial_compound_assignment, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  auto l = Poly({
+      {0, 1},
+      {1, 2},
+      {3, 4},
+  });
+  auto m = Poly({
+      {1, 5},
+      {2, 6},
+  });
+
+  auto sum = l;
+  sum += m;
+  BOOST_TEST(sum.size() == 4);
+  BOOST_TEST(sum.at(0) == 1);
+  BOOST_TEST(sum.at(1) == 7);
+  BOOST_TEST(sum.at(2) == 6);
+  BOOST_TEST(sum.at(3) == 4);
+
+  auto sub = l;
+  sub -= m;
+  BOOST_TEST(sub.at(1) == -3);
+  BOOST_TEST(sub.at(2) == -6);
+
+  auto prod = l;
+  prod *= m;
+  BOOST_TEST(prod.size() == 5);
+  BOOST_TEST(prod.at(1) == 5);
+  BOOST_TEST(prod.at(2) == 16);
+  BOOST_TEST(prod.at(3) == 12);
+  BOOST_TEST(prod.at(4) == 20);
+  BOOST_TEST(prod.at(5) == 24);
+}
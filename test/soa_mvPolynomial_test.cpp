@@ -0,0 +1,161 @@
+#define BOOST_TEST_MODULE soa_mvPolynomial_unit_test
+
+#include "boost/test/unit_test.hpp"
+#include "mvPolynomial/soa_mvPolynomial.hpp"
+#include "mvPolynomial/mvPolynomial.hpp"
+
+#include <vector>
+
+namespace utf = boost::unit_test;
+namespace tt  = boost::test_tools;
+
+using MP2  = mvPolynomial::MVPolynomial<int, double, 2>;
+using SoA2 = mvPolynomial::SoAMVPolynomial<int, double, 2>;
+
+BOOST_AUTO_TEST_CASE(soa_mvPolynomial_init, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  auto ans = std::vector<std::pair<Eigen::Array2i, double>>();
+  ans      = {
+      {{0, 0}, 1},
+      {{1, 0}, 2},
+      {{0, 1}, 3},
+      {{1, 1}, 4},
+      {{2, 0}, 5},
+      {{0, 2}, 6},
+  };
+
+  auto m = SoA2(ans.begin(), ans.end());
+  BOOST_TEST(m.size() == ans.size());
+  for (std::size_t i = 0; i < ans.size(); ++i) {
+    BOOST_TEST(m[ans[i].first] == ans[i].second);
+  }
+  // The indexes are sorted in the same order as MVPolynomial.
+  auto mp = MP2(ans.begin(), ans.end());
+  auto it = m.begin();
+  for (const auto& [index, value] : mp) {
+    auto [soa_index, soa_value] = *it;
+    BOOST_TEST((soa_index == index).all());
+    BOOST_TEST(soa_value == value);
+    ++it;
+  }
+  BOOST_TEST((m.indexes().col(0) == Eigen::Array2i(2, 0)).all());
+  BOOST_TEST(m.coefficients()[0] == 5);
+}
+
+BOOST_AUTO_TEST_CASE(soa_mvPolynomial_conversion) {
+  auto mp  = MP2({
+      {{0, 0}, 1},
+      {{1, 0}, 2},
+      {{0, 1}, 3},
+  });
+  auto soa = SoA2(mp);
+  BOOST_TEST(soa.size() == mp.size());
+  auto back = MP2(boost::container::ordered_unique_range, soa.begin(), soa.end());
+  BOOST_TEST(back.size() == mp.size());
+  for (const auto& [index, value] : mp) {
+    BOOST_TEST(back.at(index) == value);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(soa_mvPolynomial_modify) {
+  auto m = SoA2();
+  m[{1, 2}] = 3;
+  m.insert({{2, 0}, 4});
+  m.insert_or_assign({0, 0}, 5.0);
+  BOOST_TEST(m.size() == 3);
+  BOOST_TEST(m.at({0, 0}) == 5);
+  BOOST_TEST(m.count({1, 2}) == 1);
+  BOOST_TEST(m.erase({1, 2}) == 1);
+  BOOST_TEST(!m.contains({1, 2}));
+  BOOST_TEST(m.size() == 2);
+  BOOST_CHECK_THROW(m.insert({{-1, 0}, 1}), std::runtime_error);
+  BOOST_CHECK_THROW(m.at({3, 3}), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(soa_mvPolynomial_insert_range) {
+  auto m = SoA2({
+      {{0, 0}, 1},
+      {{2, 0}, 2},
+  });
+  auto terms = std::vector<std::pair<Eigen::Array2i, double>>();
+  terms      = {
+      {{0, 1}, 3},
+      {{2, 0}, 4},
+      {{3, 0}, 5},
+      {{0, 1}, 6},
+  };
+  // The existing term and the first one of the new terms which have the same index are kept.
+  m.insert(terms.begin(), terms.end());
+  auto ans = MP2({
+      {{0, 0}, 1},
+      {{2, 0}, 2},
+      {{0, 1}, 3},
+      {{3, 0}, 5},
+  });
+  BOOST_TEST(m.size() == ans.size());
+  auto it = m.begin();
+  for (const auto& [index, value] : ans) {
+    auto [soa_index, soa_value] = *it;
+    BOOST_TEST((soa_index == index).all());
+    BOOST_TEST(soa_value == value);
+    ++it;
+  }
+  // A negative index leaves the polynomial as it was.
+  terms = {
+      {{10, 1}, 7},
+      {{-1, 0}, 8},
+  };
+  BOOST_CHECK_THROW(m.insert(terms.begin(), terms.end()), std::runtime_error);
+  BOOST_TEST(m.size() == ans.size());
+}
+
+BOOST_AUTO_TEST_CASE(soa_mvPolynomial_kernels, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  auto ans = std::vector<std::pair<Eigen::Array2i, double>>();
+  ans      = {
+      {{0, 0}, 1},
+      {{1, 0}, 2},
+      {{0, 1}, 3},
+      {{1, 1}, 4},
+      {{2, 0}, 5},
+      {{0, 2}, 6},
+  };
+  auto m  = SoA2(ans.begin(), ans.end());
+  auto mp = MP2(ans.begin(), ans.end());
+
+  BOOST_TEST(Of(m, {2, 3}) == 112);
+
+  auto neg = -m;
+  auto scaled = m;
+  scaled *= -1;
+  BOOST_TEST(neg == scaled);
+
+  auto check = [](const SoA2& soa, const MP2& expected) {
+    BOOST_TEST(soa.size() == expected.size());
+    for (const auto& [index, value] : expected) {
+      BOOST_TEST(soa.at(index) == value);
+    }
+  };
+  check(D(m, 0), D(mp, 0));
+  check(D(m, 1), D(mp, 1));
+  check(Integrate(m, 0), Integrate(mp, 0));
+  check(Integrate(m, 1), Integrate(mp, 1));
+
+  auto l  = SoA2({{{0, 0}, 1}, {{1, 0}, 2}, {{0, 1}, 3}});
+  auto lp = MP2({{{0, 0}, 1}, {{1, 0}, 2}, {{0, 1}, 3}});
+  check(l + m, lp + mp);
+  check(l - m, lp - mp);
+  check(
+      l * m,
+      MP2({
+          {{0, 0}, 1},
+          {{1, 0}, 4},
+          {{0, 1}, 6},
+          {{2, 0}, 9},
+          {{1, 1}, 16},
+          {{0, 2}, 15},
+          {{3, 0}, 10},
+          {{2, 1}, 23},
+          {{1, 2}, 24},
+          {{0, 3}, 18},
+      })
+  );
+}
@@ -0,0 +1,101 @@
+#define BOOST_TEST_MODULE static_mvPolynomial_unit_test
+
+#include "boost/test/unit_test.hpp"
+#include "mvPolynomial/mvPolynomial.hpp"
+#include "mvPolynomial/static_mvPolynomial.hpp"
+
+#include <array>
+#include <stdexcept>
+
+namespace utf = boost::unit_test;
+namespace tt  = boost::test_tools;
+
+template <std::size_t N>
+using SMP2 = mvPolynomial::StaticMVPolynomial<int, double, 2, N>;
+using MP2  = mvPolynomial::MVPolynomial<int, double, 2>;
+
+// 1 + 2 x + 3 y^2 + x y
+constexpr auto p = SMP2<4>({{{0, 0}, {1, 0}, {0, 2}, {1, 1}}}, {1.0, 2.0, 3.0, 1.0});
+// 1 - y
+constexpr auto q = SMP2<2>({{{0, 0}, {0, 1}}}, {1.0, -1.0});
+
+BOOST_AUTO_TEST_CASE(static_mvPolynomial_init) {
+  static_assert(p.size() == 4);
+  static_assert(p.indexes[0] == std::array{1, 1});
+  static_assert(p.indexes[1] == std::array{1, 0});
+  static_assert(p.indexes[2] == std::array{0, 2});
+  static_assert(p.indexes[3] == std::array{0, 0});
+  static_assert(p.at({0, 2}) == 3);
+  static_assert(p.at({2, 2}) == 0);
+  static_assert(p.degrees() == std::array{1, 2});
+
+  BOOST_CHECK_THROW(SMP2<2>({{{0, 0}, {0, 0}}}, {1.0, 2.0}), std::runtime_error);
+  BOOST_CHECK_THROW(SMP2<1>({{{0, -1}}}, {1.0}), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(static_mvPolynomial_of, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  constexpr auto x = std::array{2.0, 3.0};
+  static_assert(Of(p, x) == 1 + 4 + 27 + 6);
+  static_assert(mvPolynomial::Of<p>(x) == 1 + 4 + 27 + 6);
+
+  const auto mp = p.ToMVPolynomial();
+  const auto y  = MP2::coord_type(0.5, -1.25);
+  BOOST_TEST(Of(p, y) == Of(mp, y));
+  BOOST_TEST(mvPolynomial::Of<p>(y) == Of(mp, y));
+}
+
+BOOST_AUTO_TEST_CASE(static_mvPolynomial_d_integrate) {
+  // 2 + y
+  constexpr auto dx = mvPolynomial::D<p, 0>();
+  static_assert(dx.size() == 2);
+  static_assert(dx.at({0, 0}) == 2 && dx.at({0, 1}) == 1);
+  // x + 6 y
+  constexpr auto dy = mvPolynomial::D<p, 1>();
+  static_assert(dy.size() == 2);
+  static_assert(dy.at({1, 0}) == 1 && dy.at({0, 1}) == 6);
+
+  constexpr auto integral = Integrate(p, 1);
+  static_assert(integral.size() == 4);
+  static_assert(integral.at({0, 3}) == 1 && integral.at({1, 2}) == 0.5);
+  static_assert(mvPolynomial::D<integral, 1>() == p);
+
+  BOOST_CHECK_THROW(Integrate(p, 2), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(static_mvPolynomial_product) {
+  // (1 + 2 x + 3 y^2 + x y)(1 - y) = 1 + 2 x - y + 3 y^2 - x y - 3 y^3 - x y^2
+  constexpr auto pq = mvPolynomial::Product<p, q>();
+  static_assert(pq.size() == 7);
+  static_assert(pq.at({0, 0}) == 1);
+  static_assert(pq.at({1, 0}) == 2);
+  static_assert(pq.at({0, 1}) == -1);
+  static_assert(pq.at({0, 2}) == 3);
+  static_assert(pq.at({1, 1}) == -1);
+  static_assert(pq.at({0, 3}) == -3);
+  static_assert(pq.at({1, 2}) == -1);
+
+  const auto expected = p.ToMVPolynomial() * q.ToMVPolynomial();
+  const auto actual   = pq.ToMVPolynomial();
+  BOOST_TEST(actual.size() == expected.size());
+  for (const auto& [index, value] : expected) {
+    BOOST_TEST(actual.at(index) == value);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(static_mvPolynomial_conversion) {
+  const auto mp = MP2({
+      {{0, 0}, 1},
+      {{2, 1}, 2},
+      {{0, 3}, 3},
+  });
+  const auto sp = SMP2<3>(mp);
+  BOOST_TEST(sp.at({2, 1}) == 2);
+  BOOST_TEST(sp.at({0, 3}) == 3);
+
+  const auto back = sp.ToMVPolynomial();
+  BOOST_TEST(back.size() == 3);
+  BOOST_TEST(back.at({0, 0}) == 1);
+  BOOST_TEST(back.at({2, 1}) == 2);
+
+  BOOST_CHECK_THROW(SMP2<2>{mp}, std::runtime_error);
+}
@@ -0,0 +1,107 @@
+#define BOOST_TEST_MODULE sum_unit_test
+
+#include "boost/test/unit_test.hpp"
+#include "mvPolynomial/sum.hpp"
+#include "mvPolynomial/mvPolynomial.hpp"
+#include "mvPolynomial/polynomial.hpp"
+
+#include <random>
+#include <vector>
+
+namespace utf = boost::unit_test;
+namespace tt  = boost::test_tools;
+
+using MP3  = mvPolynomial::MVPolynomial<int, double, 3>;
+using Poly = mvPolynomial::DefaultPolynomial<int, double>;
+
+std::vector<MP3> RandomMP3s(std::size_t n) {
+  auto engine = std::mt19937(0);
+  auto dist   = std::uniform_int_distribution<int>(0, 4);
+  auto coeff  = std::uniform_real_distribution<double>(-1, 1);
+  auto ps     = std::vector<MP3>();
+  for (std::size_t k = 0; k != n; ++k) {
+    auto p = MP3();
+    for (auto i = 0; i != 10; ++i) {
+      p[{dist(engine), dist(engine), dist(engine)}] = coeff(engine);
+    }
+    ps.push_back(p);
+  }
+  return ps;
+}
+
+BOOST_AUTO_TEST_CASE(sum_mvPolynomials) {
+  auto ps  = RandomMP3s(50);
+  auto ans = ps[0];
+  for (std::size_t k = 1; k != ps.size(); ++k) {
+    ans = ans + ps[k];
+  }
+
+  auto sum = mvPolynomial::Sum(ps);
+  BOOST_TEST(sum.size() == ans.size());
+  auto it = ans.begin();
+  for (const auto& [index, value] : sum) {
+    BOOST_TEST((index == it->first).all());
+    // The terms are summed in the same order as operator+.
+    BOOST_TEST(value == it->second, tt::tolerance(0.0));
+    ++it;
+  }
+
+  auto acc = MP3();
+  mvPolynomial::AccumulateInto(acc, ps);
+  BOOST_TEST(acc.size() == ans.size());
+  for (const auto& [index, value] : ans) {
+    BOOST_TEST(acc.at(index) == value, tt::tolerance(1e-12));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(sum_empty) {
+  const auto ps     = std::vector<MP3>();
+  const auto coeffs = std::vector<double>();
+  const auto sum    = mvPolynomial::Sum(ps);
+  BOOST_TEST(sum.size() == 1);
+  BOOST_TEST(sum.at({0, 0, 0}) == 0);
+  const auto combination = mvPolynomial::Sum(ps, coeffs);
+  BOOST_TEST(combination.size() == 1);
+  BOOST_TEST(combination.at({0, 0, 0}) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(
+    sum_linear_combination, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  auto ps     = RandomMP3s(20);
+  auto coeffs = std::vector<double>();
+  auto ans    = MP3();
+  for (std::size_t k = 0; k != ps.size(); ++k) {
+    coeffs.push_back(0.5 * k - 3);
+    auto scaled = ps[k];
+    scaled *= coeffs.back();
+    ans = ans + scaled;
+  }
+
+  auto sum = mvPolynomial::Sum(ps, coeffs);
+  BOOST_TEST(sum.size() == ans.size());
+  for (const auto& [index, value] : ans) {
+    BOOST_TEST(sum.at(index) == value, tt::tolerance(1e-12));
+  }
+
+  auto acc = ps[0];
+  mvPolynomial::AccumulateInto(acc, ps, coeffs);
+  for (const auto& [index, value] : ans) {
+    auto expected = value + (ps[0].contains(index) ? ps[0].at(index) : 0.0);
+    BOOST_TEST(acc.at(index) == expected, tt::tolerance(1e-12));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(sum_polynomials, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  auto ps  = std::vector<Poly>{
+      Poly({{0, 1}, {2, 3}}),
+      Poly({{1, 4}, {2, 5}}),
+      Poly({{0, 6}, {3, 7}}),
+  };
+  auto sum = mvPolynomial::Sum(ps, std::vector<double>{1, 2, -1});
+  BOOST_TEST(sum.size() == 4);
+  BOOST_TEST(sum.at(0) == -5);
+  BOOST_TEST(sum.at(1) == 8);
+  BOOST_TEST(sum.at(2) == 13);
+  BOOST_TEST(sum.at(3) == -7);
+}
@@ -0,0 +1,82 @@
+#define BOOST_TEST_MODULE support_unit_test
+
+#include "boost/test/unit_test.hpp"
+#include "mvPolynomial/support.hpp"
+#include "mvPolynomial/mvPolynomial.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+namespace utf = boost::unit_test;
+namespace tt  = boost::test_tools;
+
+using MP3 = mvPolynomial::DefaultMVPolynomial<int, double, 3>;
+
+MP3 MakeP() {
+  auto p = MP3();
+  for (auto i = 0; i != 4; ++i) {
+    for (auto j = 0; j != 3; ++j) {
+      p[{i, j, (i + j) % 3}] = 1.0 + i - 0.5 * j;
+    }
+  }
+  return p;
+}
+
+void CheckSame(const MP3& l, const MP3& r) {
+  BOOST_TEST(l.size() == r.size());
+  auto it = r.begin();
+  for (const auto& [index, value] : l) {
+    BOOST_TEST((index == it->first).all());
+    BOOST_TEST(value == it->second);
+    ++it;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(support_round_trip) {
+  const auto p       = MakeP();
+  const auto support = mvPolynomial::MakeSupport(p);
+  const auto coeffs  = mvPolynomial::Coefficients(p);
+  BOOST_TEST(support->size() == p.size());
+  BOOST_TEST(coeffs.size() == p.size());
+  BOOST_TEST(support->has_same_indexes(p));
+  BOOST_TEST((support->degrees() == p.degrees()).all());
+
+  const auto q = mvPolynomial::ToPolynomial(*support, coeffs);
+  CheckSame(q, p);
+  BOOST_CHECK_THROW(
+      mvPolynomial::ToPolynomial(*support, std::vector<double>(p.size() + 1)), std::runtime_error
+  );
+}
+
+BOOST_AUTO_TEST_CASE(support_of, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))) {
+  const auto p       = MakeP();
+  const auto support = mvPolynomial::MakeSupport(p);
+  auto       coeffs  = mvPolynomial::Coefficients(p);
+  const auto x       = MP3::coord_type(0.5, -1.5, 0.75);
+  BOOST_TEST(Of(*support, coeffs, x) == Of(p, x));
+
+  for (auto& coeff : coeffs) {
+    coeff *= -2.0;
+  }
+  BOOST_TEST(Of(*support, coeffs, x) == -2.0 * Of(p, x));
+}
+
+BOOST_AUTO_TEST_CASE(
+    support_exact_of_set_coefficients, *utf::tolerance(tt::fpc::percent_tolerance(1e-10))
+) {
+  const auto p        = MakeP();
+  auto       exact_of = mvPolynomial::ExactOf<int, double, 3>(p);
+  const auto x        = MP3::coord_type(0.5, -1.5, 0.75);
+
+  auto coeffs = mvPolynomial::Coefficients(p);
+  for (std::size_t k = 0; k != coeffs.size(); ++k) {
+    coeffs[k] = 0.25 * k - 1.0;
+  }
+  exact_of.set_coefficients(coeffs);
+  const auto support = mvPolynomial::MakeSupport(p);
+  const auto q       = mvPolynomial::ToPolynomial(*support, coeffs);
+  BOOST_TEST(exact_of(x) == Of(q, x));
+  CheckSame(exact_of.get_polynomial(), q);
+
+  BOOST_CHECK_THROW(exact_of.set_coefficients(std::vector<double>(1)), std::runtime_error);
+}
@@ -0,0 +1,84 @@
+#define BOOST_TEST_MODULE validation_unit_test
+
+#include "boost/test/unit_test.hpp"
+#include "mvPolynomial/validation.hpp"
+#include "mvPolynomial/mvPolynomial.hpp"
+#include "mvPolynomial/polynomial.hpp"
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace utf = boost::unit_test;
+namespace tt  = boost::test_tools;
+
+using MP3        = mvPolynomial::DefaultMVPolynomial<int, double, 3>;
+using TrustedMP3 = mvPolynomial::DefaultMVPolynomial<
+    int,
+    double,
+    3,
+    std::allocator<std::pair<mvPolynomial::IndexType<int, 3>, double>>,
+    mvPolynomial::TrustIndexes>;
+using Poly        = mvPolynomial::DefaultPolynomial<int, double>;
+using TrustedPoly = mvPolynomial::DefaultPolynomial<
+    int,
+    double,
+    std::allocator<std::pair<int, double>>,
+    mvPolynomial::TrustIndexes>;
+
+BOOST_AUTO_TEST_CASE(validation_tag_skips_check) {
+  const auto terms = std::vector<MP3::value_type>{
+      {{1, 0, 0}, 1.0},
+      {{0, 0, -1}, 2.0}
+  };
+  BOOST_CHECK_THROW(
+      MP3(boost::container::ordered_unique_range, terms.begin(), terms.end()), std::runtime_error
+  );
+  // The caller guarantees the indexes, so they aren't checked.
+  BOOST_CHECK_NO_THROW(
+      MP3(mvPolynomial::ordered_unique_valid_range, terms.begin(), terms.end())
+  );
+
+  auto p = MP3();
+  BOOST_CHECK_THROW(
+      p.adopt_sequence(
+          boost::container::ordered_unique_range,
+          MP3::sequence_type(terms.begin(), terms.end())
+      ),
+      std::runtime_error
+  );
+}
+
+BOOST_AUTO_TEST_CASE(validation_policy) {
+  auto p = TrustedMP3();
+  BOOST_CHECK_NO_THROW((p[{0, -1, 0}] = 1.0));
+
+  auto q = TrustedPoly();
+  BOOST_CHECK_NO_THROW(q[-1] = 1.0);
+  BOOST_CHECK_THROW(Poly({{-1, 1.0}}), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(
+    validation_trusted_same_as_validated, *utf::tolerance(tt::fpc::percent_tolerance(1e-12))
+) {
+  auto p         = MP3();
+  auto trusted_p = TrustedMP3();
+  for (auto i = 0; i != 3; ++i) {
+    for (auto j = 0; j != 3; ++j) {
+      p[{i, j, i * j}] = trusted_p[{i, j, i * j}] = 1.0 + i - 0.5 * j;
+    }
+  }
+
+  const auto x = MP3::coord_type(0.5, -0.25, 0.75);
+  BOOST_TEST(Of(trusted_p * trusted_p, x) == Of(p * p, x));
+  BOOST_TEST(Of(D(trusted_p, 2), x) == Of(D(p, 2), x));
+  BOOST_TEST(Of(Integrate(trusted_p, 1), x) == Of(Integrate(p, 1), x));
+
+  auto q         = Poly();
+  auto trusted_q = TrustedPoly();
+  for (auto i = 0; i != 4; ++i) {
+    q[i] = trusted_q[i] = 1.0 / (i + 1);
+  }
+  BOOST_TEST(Of(D(trusted_q * trusted_q), 0.5) == Of(D(q * q), 0.5));
+  BOOST_TEST(Of(Integrate(trusted_q), 0.5) == Of(Integrate(q), 0.5));
+}